@@ -0,0 +1,31 @@
+#pragma once
+
+// Messages exchanged between the app and its background worker over
+// AppWorkerMessage. The worker owns the countdowns while the app is closed;
+// each timer travels as one compact record:
+//   data0         flags below (timer index, stage, mode, paper, state)
+//   data1, data2  low and high halves of the remaining milliseconds at the
+//                 moment the record was sent
+
+#define WORKER_MAX_TIMERS 8
+
+typedef enum {
+    WORKER_MSG_TIMER = 1,       // One timer record, in either direction
+    WORKER_MSG_DETACH,          // App is closing: worker takes over the countdowns
+    WORKER_MSG_ATTACH,          // App is in front again: worker sends its records back
+    WORKER_MSG_SYNC_DONE        // Worker has sent every record
+} WorkerMessageType;
+
+#define WORKER_RECORD_INDEX_MASK    0x000F
+#define WORKER_RECORD_STAGE_SHIFT   4
+#define WORKER_RECORD_STAGE_MASK    0x0070
+#define WORKER_RECORD_FILM          0x0080
+#define WORKER_RECORD_FIBER         0x0100
+#define WORKER_RECORD_RUNNING       0x0200
+#define WORKER_RECORD_PAUSED        0x0400
+#define WORKER_RECORD_COMPLETED     0x0800  // Stage ended while the app was closed
+#define WORKER_RECORD_AUTO          0x1000  // Auto-advance process
+#define WORKER_RECORD_DRAINING      0x2000  // In the drain gap before the stage
+
+#define WORKER_RECORD_REMAINING(msg) \
+    ((int32_t)((uint32_t)(msg)->data1 | ((uint32_t)(msg)->data2 << 16)))
@@ -1,19 +1,48 @@
 #include <pebble.h>
+#include "darkroom_worker.h"
 
+// Keys 1, 2, 4 and 5 held the settings and timing arrays as raw dumps
+// before the settings record; they are only read to migrate old installs
 #define SETTINGS_KEY 1
 #define FILM_TIMES_KEY 2
 #define RC_PRINT_TIMES_KEY 4
 #define FIBER_PRINT_TIMES_KEY 5
+#define TIMER_JOURNAL_A_KEY 6
+#define TIMER_JOURNAL_B_KEY 7
+#define SETTINGS_RECORD_KEY 8
+#define WORKER_DECLINED_KEY 9
+
+// Fixed capacity of the timer pool (trays and tanks in use at once)
+#define MAX_TIMERS 8
+
+// Longest process (Fiber paper: Develop through Wash2)
+#define MAX_STAGES 6
+
+// Drain gap choices offered in settings, in seconds
+#define DRAIN_GAP_STEP_S 5
+#define MAX_DRAIN_GAP_S 30
+
+// How far a tick's wall-clock gap may fall short of its armed delay (timer
+// jitter) before we assume the phone set the watch time back
+#define CLOCK_JUMP_TOLERANCE_MS 2000
+
+// Running countdowns show whole minutes and wake once a minute, except in
+// the final minute of a stage and for a while after any button press
+#define FINAL_MINUTE_MS 60000
+#define INTERACTION_WINDOW_MS 5000
+
+// Cues raised within a running stage: agitation during film development,
+// a warning before the stage ends, and a reminder once a stage is waiting
+#define AGITATION_INTERVAL_MS 30000
+#define PRE_END_WARNING_MS 10000
+#define STAGE_REMINDER_MS 2000
 
 // Window and layer handles
 static Window *s_main_window;
 static Layer *s_canvas_layer;
-static TextLayer *s_timer_layer;
-static TextLayer *s_mode_layer;
-static TextLayer *s_timer_name_layer;
 
-// Menu windows and layers
-static Window *s_menu_window;
+// Menu windows and layers, only allocated while the menu is open
+static Window *s_menu_window = NULL;
 static MenuLayer *s_menu_layer;
 
 // Timer states
@@ -36,42 +65,96 @@ typedef enum {
     PAPER_FIBER
 } PaperType;
 
+typedef enum {
+    CUE_NONE,
+    CUE_AGITATE,
+    CUE_WARNING,
+    CUE_REMINDER
+} CueKind;
+
 typedef struct {
+    uint8_t id;                 // Timer number shown to the user (1-based)
     bool running;
     bool paused;
     TimerMode mode;
     TimerStage stage;
     PaperType paper_type;
     int max_stages;
-    int seconds_remaining;
-    AppTimer *timer_handle;
+    int seconds_remaining;      // Displayed whole seconds, rounded up
+    int32_t remaining_ms;       // Banked time while stopped or paused
+    int64_t deadline_ms;        // Wall-clock end of the stage while running
+    int64_t next_event_ms;      // When the scheduler next needs to service it
+    CueKind cue_kind;           // Next pending cue, CUE_NONE if there is none
+    int64_t cue_ms;             // Wall-clock time of the pending cue
+    bool auto_advance;          // Runs through every stage without input
+    bool draining;              // In the drain gap before the current stage
+    uint8_t gap_s;              // Drain gap used by the schedule below
+    uint16_t stage_end_s[MAX_STAGES];   // End of each stage from process start
 } TimerState;
 
-static TimerState s_timer1 = {
-    .running = false,
-    .paused = false,
-    .mode = MODE_PRINT,
-    .stage = STAGE_DEVELOP,
-    .paper_type = PAPER_RC,
-    .max_stages = 4,
-    .seconds_remaining = 0,
-    .timer_handle = NULL
-};
-
-static TimerState s_timer2 = {
-    .running = false,
-    .paused = false,
-    .mode = MODE_PRINT,
-    .stage = STAGE_DEVELOP,
-    .paper_type = PAPER_FIBER,
-    .max_stages = 6,
-    .seconds_remaining = 0,
-    .timer_handle = NULL
-};
+// Statically allocated timer pool. Odd timers default to RC paper and a
+// light theme, even timers to Fiber paper and a dark theme.
+static TimerState s_timers[MAX_TIMERS];
 
-// Currently displayed timer (1 or 2)
+// Currently displayed timer (1-based)
 static int s_active_timer = 1;
 
+// Wall-clock time of the last button press on the main window
+static int64_t s_last_interaction_ms = 0;
+
+// The main window is only rendered while it is on top of the window stack
+// and no system overlay (notification, low battery) has taken focus
+static bool s_main_window_shown = false;
+static bool s_app_in_focus = true;
+
+static bool is_main_window_visible() {
+    return s_main_window_shown && s_app_in_focus;
+}
+
+// Change-driven rendering: state changes set dirty bits, render_commit()
+// pushes only what changed into the layers, and the canvas only draws
+#define DIRTY_TIME  (1 << 0)    // Countdown digits
+#define DIRTY_MODE  (1 << 1)    // Mode line and stage indicators
+#define DIRTY_NAME  (1 << 2)    // Timer name line
+#define DIRTY_THEME (1 << 3)    // Window and text colors
+#define DIRTY_ALL   (DIRTY_TIME | DIRTY_MODE | DIRTY_NAME | DIRTY_THEME)
+static uint8_t s_dirty = DIRTY_ALL;
+static uint32_t s_frame_count = 0;      // Frames requested this session
+static uint32_t s_redraw_count = 0;     // Render passes this session
+static uint32_t s_render_ms = 0;        // Time spent drawing this session
+static int64_t s_launch_ms = 0;         // Wall clock at the start of init()
+static uint32_t s_first_frame_ms = 0;   // Launch to the first canvas draw
+
+// Mode and name lines cached per timer, reformatted only when the fields
+// they are built from change, so steady-state ticks only format the digits
+#define TEXT_CACHE_INVALID 0xFFFF
+typedef struct {
+    uint16_t mode_key;          // get_mode_key() the mode line was built from
+    int32_t name_minutes;       // Whole-process minutes shown, -1 for none
+    int32_t name_transition;    // Next stage change shown (minutes since epoch)
+    char mode_text[32];
+    char name_text[24];
+#if defined(PBL_ROUND)
+    char pane_name_text[12];    // Split pane name, narrow enough for the bezel
+#endif
+} TextCache;
+static TextCache s_text_cache[MAX_TIMERS];
+static const char *s_shown_mode_text = NULL;    // Buffers the canvas draws
+static const char *s_shown_name_text = NULL;
+static int s_shown_progress = 0;                // Elapsed steps of the current stage
+
+// Single tick source shared by all running timers
+static AppTimer *s_tick_timer = NULL;
+static int64_t s_tick_armed_ms = 0;     // Wall-clock time the tick was armed
+static uint32_t s_tick_delay_ms = 0;    // Delay the tick was armed with
+static uint32_t s_tick_count = 0;       // Wakeups serviced this session
+
+// Min-heap of running timers keyed by next_event_ms, so the shared tick
+// is armed for exactly the earliest event and idle timers cost nothing
+static uint8_t s_event_heap[MAX_TIMERS];    // Indices into s_timers
+static int8_t s_heap_pos[MAX_TIMERS];       // Heap slot of each timer, -1 if idle
+static int s_heap_size = 0;
+
 // Settings
 typedef struct {
     bool vibration_enabled;
@@ -79,6 +162,10 @@ typedef struct {
     bool invert_timer1_colors;
     bool invert_timer2_colors;
     bool invert_menu_colors;
+    uint8_t timer_count;
+    bool auto_advance;
+    uint8_t drain_gap_s;        // Pour-out time between auto-advanced stages
+    bool split_view;            // Show two timers at once
 } Settings;
 
 static Settings s_settings = {
@@ -86,259 +173,1784 @@ static Settings s_settings = {
     .backlight_enabled = false,
     .invert_timer1_colors = false,  // Timer 1 defaults to light mode (white bg, black text)
     .invert_timer2_colors = false,  // Timer 2 defaults to dark mode (black bg, white text)
-    .invert_menu_colors = false
+    .invert_menu_colors = false,
+    .timer_count = 2,
+    .auto_advance = false,
+    .drain_gap_s = 10,
+    .split_view = false
+};
+
+// Colors of each timer, resolved from the invert settings when they load or
+// change, so drawing reads them without branching
+typedef struct {
+    bool is_light_background;
+    GColor text_color;          // Also used for stroke and fill
+    GColor background_color;
+} DisplayTheme;
+
+static DisplayTheme s_timer_themes[MAX_TIMERS];
+static const DisplayTheme *s_theme = &s_timer_themes[0];   // Displayed timer's theme
+
+static DisplayTheme get_display_theme(int timer_number) {
+    bool odd_timer = (timer_number % 2 == 1);
+    bool should_invert = odd_timer ?
+        s_settings.invert_timer1_colors : s_settings.invert_timer2_colors;
+    
+    // Odd timers default to light mode, even timers default to dark mode
+    bool default_light = odd_timer;
+    
+    // Apply inversion settings to override defaults
+    if (should_invert) {
+        default_light = !default_light;
+    }
+    
+    return (DisplayTheme){
+        .is_light_background = default_light,
+        .text_color = default_light ? GColorBlack : GColorWhite,
+        .background_color = default_light ? GColorWhite : GColorBlack
+    };
+}
+
+static void resolve_display_themes() {
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        s_timer_themes[i] = get_display_theme(i + 1);
+    }
+}
+
+// Split view shows the timers in pairs (1 and 2, 3 and 4, ...) with the odd
+// timer on top. Returns the timer shown alongside, or 0 when the timer is
+// shown alone because split view is off or its partner is not in the pool.
+static int get_split_partner(int timer_number) {
+    int partner = (timer_number % 2 == 1) ? timer_number + 1 : timer_number - 1;
+    return (s_settings.split_view && partner <= s_settings.timer_count) ? partner : 0;
+}
+
+static bool is_split_view() {
+    return get_split_partner(s_active_timer) != 0;
+}
+
+// Whether a timer's countdown is on screen right now
+static bool is_timer_displayed(TimerState *timer) {
+    return is_main_window_visible() &&
+           (timer->id == s_active_timer || timer->id == get_split_partner(s_active_timer));
+}
+
+// Timer settings (in seconds)
+static int film_times[4] = {
+    300,  // Develop: 5 mins
+    60,   // Stop: 1 min
+    300,  // Fix: 5 mins
+    300   // Wash: 5 mins
+};
+
+// RC paper timing (4 stages)
+static int rc_print_times[4] = {
+    60,   // Develop: 1 min
+    30,   // Stop: 30 secs
+    300,  // Fix: 5 mins
+    300   // Wash: 5 mins
+};
+
+// Fiber paper timing (6 stages)
+static int fiber_print_times[6] = {
+    120,  // Develop: 2 min
+    30,   // Stop: 30 sec
+    120,  // Fix: 2 min
+    300,  // Wash: 5 min
+    120,  // Hypo Clear: 2 min
+    900   // Wash2: 15 min
+};
+
+// Compact copy of one timer, journaled on every state transition
+typedef struct {
+    uint8_t running;
+    uint8_t paused;
+    uint8_t mode;
+    uint8_t paper_type;
+    uint8_t stage;
+    uint8_t auto_advance;
+    uint8_t draining;
+    int32_t remaining_ms;   // Banked time while paused or stopped
+    int64_t deadline_ms;    // Wall-clock deadline while running
+} TimerSnapshot;
+
+// Timer journal: written alternately to two slots so a crash or reboot
+// mid-write always leaves the previous record intact
+typedef struct {
+    uint32_t sequence;
+    TimerSnapshot timers[MAX_TIMERS];
+    uint32_t crc;
+} TimerJournal;
+
+static TimerJournal s_journal;
+static bool s_journal_valid = false;
+
+static uint32_t crc32(const void *data, size_t length) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t journal_crc(const TimerJournal *journal) {
+    return crc32(journal, offsetof(TimerJournal, crc));
+}
+
+// Record the current state of every timer after a start, pause or stage change
+static void journal_write() {
+    uint32_t sequence = s_journal.sequence + 1;
+    
+    memset(&s_journal, 0, sizeof(s_journal));
+    s_journal.sequence = sequence;
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        TimerState *timer = &s_timers[i];
+        s_journal.timers[i] = (TimerSnapshot){
+            .running = timer->running,
+            .paused = timer->paused,
+            .mode = timer->mode,
+            .paper_type = timer->paper_type,
+            .stage = timer->stage,
+            .auto_advance = timer->auto_advance,
+            .draining = timer->draining,
+            .remaining_ms = timer->remaining_ms,
+            .deadline_ms = timer->deadline_ms
+        };
+    }
+    s_journal.crc = journal_crc(&s_journal);
+    s_journal_valid = true;
+    
+    uint32_t key = (sequence & 1) ? TIMER_JOURNAL_B_KEY : TIMER_JOURNAL_A_KEY;
+    persist_write_data(key, &s_journal, sizeof(s_journal));
+}
+
+static bool journal_read_slot(uint32_t key, TimerJournal *journal) {
+    return persist_read_data(key, journal, sizeof(*journal)) == (int)sizeof(*journal) &&
+           journal->crc == journal_crc(journal);
+}
+
+// Recover the newest intact journal slot: two reads, whatever state we crashed in
+static void load_timer_journal() {
+    TimerJournal slot_b;
+    bool a_valid = journal_read_slot(TIMER_JOURNAL_A_KEY, &s_journal);
+    bool b_valid = journal_read_slot(TIMER_JOURNAL_B_KEY, &slot_b);
+    
+    if (b_valid && (!a_valid || (int32_t)(slot_b.sequence - s_journal.sequence) > 0)) {
+        s_journal = slot_b;
+    }
+    s_journal_valid = a_valid || b_valid;
+    if (!s_journal_valid) {
+        memset(&s_journal, 0, sizeof(s_journal));
+    }
+}
+
+// Persistent storage functions
+
+// Settings and all stage times are stored as one record, read in a single
+// persist_read_data at launch. Fields are ordered so the record has no
+// padding; bump the version whenever the layout changes.
+#define SETTINGS_RECORD_VERSION 1
+
+#define SETTINGS_FLAG_VIBRATION     (1 << 0)
+#define SETTINGS_FLAG_BACKLIGHT     (1 << 1)
+#define SETTINGS_FLAG_INVERT_TIMER1 (1 << 2)
+#define SETTINGS_FLAG_INVERT_TIMER2 (1 << 3)
+#define SETTINGS_FLAG_INVERT_MENU   (1 << 4)
+#define SETTINGS_FLAG_AUTO_ADVANCE  (1 << 5)
+#define SETTINGS_FLAG_SPLIT_VIEW    (1 << 6)
+
+typedef struct {
+    uint8_t version;
+    uint8_t flags;
+    uint8_t timer_count;
+    uint8_t drain_gap_s;
+    uint16_t film_times[ARRAY_LENGTH(film_times)];
+    uint16_t rc_print_times[ARRAY_LENGTH(rc_print_times)];
+    uint16_t fiber_print_times[ARRAY_LENGTH(fiber_print_times)];
+    uint32_t crc;
+} SettingsRecord;
+
+static void pack_times(uint16_t *packed, const int *times, int count) {
+    for (int i = 0; i < count; i++) {
+        packed[i] = (uint16_t)times[i];
+    }
+}
+
+static void unpack_times(int *times, const uint16_t *packed, int count) {
+    for (int i = 0; i < count; i++) {
+        times[i] = packed[i];
+    }
+}
+
+static void pack_settings(SettingsRecord *record) {
+    memset(record, 0, sizeof(*record));
+    record->version = SETTINGS_RECORD_VERSION;
+    record->flags = (s_settings.vibration_enabled ? SETTINGS_FLAG_VIBRATION : 0) |
+                    (s_settings.backlight_enabled ? SETTINGS_FLAG_BACKLIGHT : 0) |
+                    (s_settings.invert_timer1_colors ? SETTINGS_FLAG_INVERT_TIMER1 : 0) |
+                    (s_settings.invert_timer2_colors ? SETTINGS_FLAG_INVERT_TIMER2 : 0) |
+                    (s_settings.invert_menu_colors ? SETTINGS_FLAG_INVERT_MENU : 0) |
+                    (s_settings.auto_advance ? SETTINGS_FLAG_AUTO_ADVANCE : 0) |
+                    (s_settings.split_view ? SETTINGS_FLAG_SPLIT_VIEW : 0);
+    record->timer_count = s_settings.timer_count;
+    record->drain_gap_s = s_settings.drain_gap_s;
+    pack_times(record->film_times, film_times, ARRAY_LENGTH(film_times));
+    pack_times(record->rc_print_times, rc_print_times, ARRAY_LENGTH(rc_print_times));
+    pack_times(record->fiber_print_times, fiber_print_times, ARRAY_LENGTH(fiber_print_times));
+    record->crc = crc32(record, offsetof(SettingsRecord, crc));
+}
+
+static void unpack_settings(const SettingsRecord *record) {
+    s_settings.vibration_enabled = record->flags & SETTINGS_FLAG_VIBRATION;
+    s_settings.backlight_enabled = record->flags & SETTINGS_FLAG_BACKLIGHT;
+    s_settings.invert_timer1_colors = record->flags & SETTINGS_FLAG_INVERT_TIMER1;
+    s_settings.invert_timer2_colors = record->flags & SETTINGS_FLAG_INVERT_TIMER2;
+    s_settings.invert_menu_colors = record->flags & SETTINGS_FLAG_INVERT_MENU;
+    s_settings.auto_advance = record->flags & SETTINGS_FLAG_AUTO_ADVANCE;
+    s_settings.split_view = record->flags & SETTINGS_FLAG_SPLIT_VIEW;
+    s_settings.timer_count = record->timer_count;
+    s_settings.drain_gap_s = record->drain_gap_s;
+    unpack_times(film_times, record->film_times, ARRAY_LENGTH(film_times));
+    unpack_times(rc_print_times, record->rc_print_times, ARRAY_LENGTH(rc_print_times));
+    unpack_times(fiber_print_times, record->fiber_print_times, ARRAY_LENGTH(fiber_print_times));
+}
+
+// Settings changes are written behind: edits mark the settings dirty, and
+// the record is written when the menu closes, the app loses focus or exits,
+// or after a quiet spell of editing
+#define SETTINGS_FLUSH_IDLE_MS 10000
+
+static bool s_settings_dirty = false;
+static AppTimer *s_settings_flush_timer = NULL;
+static uint32_t s_settings_writes = 0;
+
+static void write_settings_record() {
+    SettingsRecord record;
+    pack_settings(&record);
+    persist_write_data(SETTINGS_RECORD_KEY, &record, sizeof(record));
+    s_settings_writes++;
+}
+
+static void flush_settings() {
+    if (s_settings_flush_timer) {
+        app_timer_cancel(s_settings_flush_timer);
+        s_settings_flush_timer = NULL;
+    }
+    if (s_settings_dirty) {
+        write_settings_record();
+        s_settings_dirty = false;
+    }
+}
+
+static void settings_flush_callback(void *data) {
+    s_settings_flush_timer = NULL;
+    flush_settings();
+}
+
+static void mark_settings_dirty() {
+    s_settings_dirty = true;
+    if (!s_settings_flush_timer || !app_timer_reschedule(s_settings_flush_timer, SETTINGS_FLUSH_IDLE_MS)) {
+        s_settings_flush_timer = app_timer_register(SETTINGS_FLUSH_IDLE_MS, settings_flush_callback, NULL);
+    }
+}
+
+// Carry settings over from the per-object keys used before the record,
+// then store them as a record and drop the old keys
+static void migrate_legacy_settings() {
+    if (!persist_exists(SETTINGS_KEY) && !persist_exists(FILM_TIMES_KEY) &&
+        !persist_exists(RC_PRINT_TIMES_KEY) && !persist_exists(FIBER_PRINT_TIMES_KEY)) {
+        return;
+    }
+    
+    if (persist_exists(SETTINGS_KEY)) {
+        persist_read_data(SETTINGS_KEY, &s_settings, sizeof(Settings));
+    }
+    if (persist_exists(FILM_TIMES_KEY)) {
+        persist_read_data(FILM_TIMES_KEY, &film_times, sizeof(film_times));
+    }
+    if (persist_exists(RC_PRINT_TIMES_KEY)) {
+        persist_read_data(RC_PRINT_TIMES_KEY, &rc_print_times, sizeof(rc_print_times));
+    }
+    if (persist_exists(FIBER_PRINT_TIMES_KEY)) {
+        persist_read_data(FIBER_PRINT_TIMES_KEY, &fiber_print_times, sizeof(fiber_print_times));
+    }
+    
+    write_settings_record();
+    persist_delete(SETTINGS_KEY);
+    persist_delete(FILM_TIMES_KEY);
+    persist_delete(RC_PRINT_TIMES_KEY);
+    persist_delete(FIBER_PRINT_TIMES_KEY);
+}
+
+static void load_settings() {
+    SettingsRecord record;
+    int length = persist_read_data(SETTINGS_RECORD_KEY, &record, sizeof(record));
+    
+    if (length == (int)sizeof(record) && record.version == SETTINGS_RECORD_VERSION &&
+        record.crc == crc32(&record, offsetof(SettingsRecord, crc))) {
+        unpack_settings(&record);
+    } else if (length <= 0) {
+        migrate_legacy_settings();
+    } else {
+        // Truncated, corrupted or from an unknown version: keep the defaults
+        APP_LOG(APP_LOG_LEVEL_WARNING, "Settings record rejected (%d bytes, version %d)",
+                length, record.version);
+    }
+    
+    if (s_settings.timer_count < 1 || s_settings.timer_count > MAX_TIMERS) {
+        s_settings.timer_count = 2;
+    }
+    if (s_settings.drain_gap_s > MAX_DRAIN_GAP_S) {
+        s_settings.drain_gap_s = 10;
+    }
+    
+    resolve_display_themes();
+    load_timer_journal();
+}
+
+// Timer configuration structure
+typedef struct {
+    TimerMode mode;
+    PaperType paper_type;
+    int *timing_array;
+    int stage_count;
+    const char *paper_name;
+} TimerConfig;
+
+// Timer configuration lookup helper function
+static TimerConfig get_timer_config(int timer_number, TimerMode mode) {
+    if (mode == MODE_FILM) {
+        return (TimerConfig){
+            .mode = MODE_FILM,
+            .paper_type = PAPER_RC, // Not applicable for film
+            .timing_array = film_times,
+            .stage_count = 4,
+            .paper_name = "Film"
+        };
+    } else {
+        // Odd timers = RC, even timers = Fiber
+        if (timer_number % 2 == 1) {
+            return (TimerConfig){
+                .mode = MODE_PRINT,
+                .paper_type = PAPER_RC,
+                .timing_array = rc_print_times,
+                .stage_count = 4,
+                .paper_name = "RC"
+            };
+        } else {
+            return (TimerConfig){
+                .mode = MODE_PRINT,
+                .paper_type = PAPER_FIBER,
+                .timing_array = fiber_print_times,
+                .stage_count = 6,
+                .paper_name = "FB"
+            };
+        }
+    }
+}
+
+static TimerState* get_active_timer() {
+    return &s_timers[s_active_timer - 1];
+}
+
+// Current wall-clock time in milliseconds
+static int64_t now_ms() {
+    time_t seconds;
+    uint16_t millis;
+    time_ms(&seconds, &millis);
+    return (int64_t)seconds * 1000 + millis;
+}
+
+// Whether a countdown is shown (and ticked) in whole minutes right now
+static bool use_minute_resolution(TimerState *timer, int64_t now) {
+    return timer->running &&
+           timer->seconds_remaining * 1000 > FINAL_MINUTE_MS &&
+           now - s_last_interaction_ms >= INTERACTION_WINDOW_MS;
+}
+
+// The timer name, mode line, countdown and stage indicators are all drawn by
+// canvas_update_proc into rects from the layout table below
+static GFont s_line_font;
+
+// Split view: one pane per timer of the displayed pair, each with its own
+// colors, name, compact countdown, mode line and stage indicators
+typedef struct {
+    GRect bounds;
+    GRect name;
+    GRect time;
+    GRect mode;
+    GRect indicators;
+    GRect marker;               // Shown on the pane the buttons act on
+} PaneLayout;
+
+typedef struct {
+    TimerState *timer;
+    const char *name_text;
+    const char *mode_text;
+    char time_text[8];
+    int progress;               // Filled width of the current stage's bar
+} SplitPane;
+
+static GFont s_pane_font;
+static SplitPane s_split_panes[2];
+
+// Screen geometry, fixed per platform at compile time
+typedef struct {
+    GRect name;
+    GRect mode;
+    GRect digits;
+    GRect indicators;
+    PaneLayout panes[2];        // Split view, top and bottom
+} ScreenLayout;
+
+#define LAYOUT_RECT(x, y, w, h) {{(x), (y)}, {(w), (h)}}
+
+#if defined(PBL_ROUND)
+// chalk, 180x180 round: lines kept inside the bezel and indicators inset
+// where the circle narrows. Split panes are mirrored around the middle so
+// the wide mode lines sit where the display is widest.
+static const ScreenLayout s_layout = {
+    .name = LAYOUT_RECT(0, 24, 180, 20),
+    .mode = LAYOUT_RECT(0, 46, 180, 20),
+    .digits = LAYOUT_RECT(0, 72, 180, 56),
+    .indicators = LAYOUT_RECT(0, 0, 180, 180),    // Stage ring around the bezel
+    .panes = {
+        {
+            .bounds = LAYOUT_RECT(0, 0, 180, 90),
+            .name = LAYOUT_RECT(0, 11, 180, 20),
+            .time = LAYOUT_RECT(0, 29, 180, 30),
+            .mode = LAYOUT_RECT(0, 59, 180, 20),
+            .indicators = LAYOUT_RECT(30, 83, 120, 3),
+            .marker = LAYOUT_RECT(23, 37, 3, 18)
+        },
+        {
+            .bounds = LAYOUT_RECT(0, 90, 180, 90),
+            .name = LAYOUT_RECT(0, 149, 180, 20),
+            .time = LAYOUT_RECT(0, 121, 180, 30),
+            .mode = LAYOUT_RECT(0, 101, 180, 20),
+            .indicators = LAYOUT_RECT(30, 94, 120, 3),
+            .marker = LAYOUT_RECT(23, 129, 3, 18)
+        }
+    }
+};
+#else
+// aplite, basalt and diorite, 144x168
+static const ScreenLayout s_layout = {
+    .name = LAYOUT_RECT(0, 10, 144, 20),
+    .mode = LAYOUT_RECT(0, 40, 144, 20),
+    .digits = LAYOUT_RECT(0, 70, 144, 68),
+    .indicators = LAYOUT_RECT(10, 148, 124, 3),
+    .panes = {
+        {
+            .bounds = LAYOUT_RECT(0, 0, 144, 84),
+            .name = LAYOUT_RECT(0, 3, 144, 20),
+            .time = LAYOUT_RECT(0, 23, 144, 30),
+            .mode = LAYOUT_RECT(0, 53, 144, 20),
+            .indicators = LAYOUT_RECT(10, 77, 124, 3),
+            .marker = LAYOUT_RECT(3, 31, 3, 18)
+        },
+        {
+            .bounds = LAYOUT_RECT(0, 84, 144, 84),
+            .name = LAYOUT_RECT(0, 145, 144, 20),
+            .time = LAYOUT_RECT(0, 115, 144, 30),
+            .mode = LAYOUT_RECT(0, 95, 144, 20),
+            .indicators = LAYOUT_RECT(10, 88, 124, 3),
+            .marker = LAYOUT_RECT(3, 123, 3, 18)
+        }
+    }
+};
+#endif
+
+// Countdown digits, drawn as fixed-width cells. Glyph widths are measured
+// once, cell rects are only recomputed when the shape of the text changes
+// ("14m" to "00:59"), and each cell keeps its own one-glyph string, so a
+// tick that changes nothing requests no frame.
+#define DIGIT_CELLS 6
+static GFont s_digit_font;
+static char s_digit_text[DIGIT_CELLS + 1];      // What the cells currently show
+static char s_digit_glyphs[DIGIT_CELLS][2];     // Per-cell glyph strings
+static GRect s_digit_cells[DIGIT_CELLS];
+static int16_t s_digit_width, s_colon_width, s_unit_width;
+static uint32_t s_digit_glyph_changes = 0;     // Glyphs changed this session
+
+static int16_t get_glyph_width(char c) {
+    if (c >= '0' && c <= '9') {
+        return s_digit_width;
+    }
+    return c == ':' ? s_colon_width : s_unit_width;
+}
+
+// Measure the glyphs once; digits share the widest width so they never shift
+static void measure_digit_glyphs() {
+    GRect box = GRect(0, 0, 200, 100);
+    char glyph[2] = { '0', '\0' };
+    
+    s_digit_width = 0;
+    for (char c = '0'; c <= '9'; c++) {
+        glyph[0] = c;
+        GSize size = graphics_text_layout_get_content_size(glyph, s_digit_font, box,
+                                                           GTextOverflowModeFill, GTextAlignmentLeft);
+        if (size.w > s_digit_width) {
+            s_digit_width = size.w;
+        }
+    }
+    s_colon_width = graphics_text_layout_get_content_size(":", s_digit_font, box,
+                                                          GTextOverflowModeFill, GTextAlignmentLeft).w;
+    s_unit_width = graphics_text_layout_get_content_size("m", s_digit_font, box,
+                                                         GTextOverflowModeFill, GTextAlignmentLeft).w;
+}
+
+// Center the cells for the current text shape
+static void layout_digit_cells() {
+    GRect bounds = s_layout.digits;
+    int len = strlen(s_digit_text);
+    int16_t total = 0;
+    
+    for (int i = 0; i < len; i++) {
+        total += get_glyph_width(s_digit_text[i]);
+    }
+    int16_t x = bounds.origin.x + (bounds.size.w - total) / 2;
+    for (int i = 0; i < len; i++) {
+        int16_t width = get_glyph_width(s_digit_text[i]);
+        s_digit_cells[i] = GRect(x, bounds.origin.y, width, bounds.size.h);
+        x += width;
+    }
+}
+
+// Returns whether any cell changed; the caller invalidates the frame
+static bool set_digit_text(const char *text) {
+    int len = strlen(text);
+    bool relayout = len != (int)strlen(s_digit_text);
+    int changed = 0;
+    
+    for (int i = 0; i < len; i++) {
+        if (text[i] == s_digit_text[i]) {
+            continue;
+        }
+        // A colon or unit moving to another cell changes the cell widths
+        relayout |= get_glyph_width(text[i]) != get_glyph_width(s_digit_text[i]);
+        s_digit_glyphs[i][0] = text[i];
+        changed++;
+    }
+    if (changed == 0 && !relayout) {
+        return false;
+    }
+    
+    strncpy(s_digit_text, text, DIGIT_CELLS);
+    if (relayout) {
+        layout_digit_cells();
+    }
+    s_digit_glyph_changes += changed;
+    return true;
+}
+
+static void draw_digit_cells(GContext *ctx) {
+    for (int i = 0; s_digit_text[i] != '\0'; i++) {
+        graphics_draw_text(ctx, s_digit_glyphs[i], s_digit_font, s_digit_cells[i],
+                           GTextOverflowModeFill, GTextAlignmentCenter, NULL);
+    }
+}
+
+static void format_countdown(TimerState *timer, char *buffer, size_t size) {
+    if (use_minute_resolution(timer, now_ms())) {
+        // Rounded up, so "1m" never shows while more than a minute is left
+        snprintf(buffer, size, "%dm", (timer->seconds_remaining + 59) / 60);
+    } else {
+        int minutes = timer->seconds_remaining / 60;
+        int seconds = timer->seconds_remaining % 60;
+        snprintf(buffer, size, "%02d:%02d", minutes, seconds);
+    }
+}
+
+static bool update_timer_text() {
+    char buffer[DIGIT_CELLS + 1];
+    format_countdown(get_active_timer(), buffer, sizeof(buffer));
+    return set_digit_text(buffer);
+}
+
+// Fields the mode line is formatted from, packed into one comparable key
+static uint16_t get_mode_key(TimerState *timer) {
+    uint16_t status = timer->paused ? 2 : (timer->running ? (timer->draining ? 3 : 1) : 0);
+    return (uint16_t)(timer->mode | (timer->paper_type << 1) | (timer->stage << 2) | (status << 5));
+}
+
+// A timer's mode line, reformatted only when its key changed
+static const char *get_mode_text(TimerState *timer) {
+    TextCache *cache = &s_text_cache[timer->id - 1];
+    uint16_t key = get_mode_key(timer);
+    
+    if (key != cache->mode_key) {
+        char mode_char = (timer->mode == MODE_FILM) ? 'F' : 'P';
+        
+        // Get paper type string
+        const char *paper_type = "Film";
+        if (timer->mode == MODE_PRINT) {
+            paper_type = (timer->paper_type == PAPER_RC) ? "RC" : "FB";
+        }
+        
+        // Get stage text
+        const char *stage_text = "Unknown";
+        switch (timer->stage) {
+            case STAGE_DEVELOP: stage_text = "Dev"; break;
+            case STAGE_STOP: stage_text = "Stop"; break;
+            case STAGE_FIX: stage_text = "Fix"; break;
+            case STAGE_WASH: stage_text = "Wash"; break;
+            case STAGE_HYPO_CLEAR: stage_text = "HC"; break;
+            case STAGE_WASH2: stage_text = "Wash2"; break;
+        }
+        
+        // Format: [P,F] | [RC,FB] | [Stage] | [Status]
+        const char *status = timer->paused ? "PAUSED" :
+                             (timer->draining && timer->running) ? "POUR" :
+                             (timer->running ? "RUNNING" : "");
+        if (status[0] != '\0') {
+            snprintf(cache->mode_text, sizeof(cache->mode_text), "%c | %s | %s | %s",
+                     mode_char, paper_type, stage_text, status);
+        } else {
+            snprintf(cache->mode_text, sizeof(cache->mode_text), "%c | %s | %s",
+                     mode_char, paper_type, stage_text);
+        }
+        cache->mode_key = key;
+        s_shown_mode_text = NULL;
+    }
+    
+    return cache->mode_text;
+}
+
+static bool update_mode_text() {
+    const char *text = get_mode_text(get_active_timer());
+    if (s_shown_mode_text == text) {
+        return false;
+    }
+    s_shown_mode_text = text;
+    return true;
+}
+
+static int32_t get_process_remaining_ms(TimerState *timer, int64_t now);
+static int get_indicator_width(GRect bounds, int max_stages);
+static int get_stage_progress(TimerState *timer, int64_t now, int steps);
+
+// A timer's name line, reformatted only when the minutes or clock time shown change
+static const char *get_name_text(TimerState *timer) {
+    TextCache *cache = &s_text_cache[timer->id - 1];
+    int32_t minutes = -1;
+    int32_t transition = -1;
+    
+    // Auto-advance: whole-process time left, and when the next stage change is due
+    if (timer->auto_advance && (timer->running || timer->paused)) {
+        minutes = (get_process_remaining_ms(timer, now_ms()) + 59999) / 60000;
+        if (timer->running) {
+            transition = (int32_t)(timer->deadline_ms / 60000);
+        }
+    }
+    
+    if (minutes != cache->name_minutes || transition != cache->name_transition) {
+        char clock[8] = "";
+        if (transition >= 0) {
+            time_t transition_time = (time_t)(timer->deadline_ms / 1000);
+            strftime(clock, sizeof(clock), clock_is_24h_style() ? "%H:%M" : "%I:%M",
+                     localtime(&transition_time));
+        }
+        
+        if (minutes < 0) {
+            snprintf(cache->name_text, sizeof(cache->name_text), "Timer %d", timer->id);
+        } else if (transition < 0) {
+            snprintf(cache->name_text, sizeof(cache->name_text), "Timer %d | %dm",
+                     timer->id, (int)minutes);
+        } else {
+            snprintf(cache->name_text, sizeof(cache->name_text), "Timer %d | %dm | %s",
+                     timer->id, (int)minutes, clock);
+        }
+#if defined(PBL_ROUND)
+        // The split panes' name lines sit where the round display is under
+        // 90px wide: keep the timer number and the next stage change only
+        if (minutes < 0) {
+            snprintf(cache->pane_name_text, sizeof(cache->pane_name_text), "Timer %d", timer->id);
+        } else if (transition < 0) {
+            snprintf(cache->pane_name_text, sizeof(cache->pane_name_text), "T%d %dm",
+                     timer->id, (int)minutes);
+        } else {
+            snprintf(cache->pane_name_text, sizeof(cache->pane_name_text), "T%d %s",
+                     timer->id, clock);
+        }
+#endif
+        cache->name_minutes = minutes;
+        cache->name_transition = transition;
+        s_shown_name_text = NULL;
+    }
+    
+    return cache->name_text;
+}
+
+// Point both panes at their timers' cached lines and format the compact
+// countdowns; returns whether either countdown changed
+static bool prepare_split_panes() {
+    int top = (s_active_timer % 2 == 1) ? s_active_timer : s_active_timer - 1;
+    bool changed = false;
+    
+    for (int i = 0; i < 2; i++) {
+        SplitPane *pane = &s_split_panes[i];
+        char time_text[sizeof(pane->time_text)];
+        pane->timer = &s_timers[top - 1 + i];
+        pane->name_text = get_name_text(pane->timer);
+#if defined(PBL_ROUND)
+        pane->name_text = s_text_cache[pane->timer->id - 1].pane_name_text;
+#endif
+        pane->mode_text = get_mode_text(pane->timer);
+        format_countdown(pane->timer, time_text, sizeof(time_text));
+        if (strcmp(time_text, pane->time_text) != 0) {
+            strcpy(pane->time_text, time_text);
+            changed = true;
+        }
+        
+        int steps = get_indicator_width(s_layout.panes[i].indicators, pane->timer->max_stages);
+        int progress = get_stage_progress(pane->timer, now_ms(), steps);
+        if (progress != pane->progress) {
+            pane->progress = progress;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+static bool update_timer_name_text() {
+    const char *text = get_name_text(get_active_timer());
+    if (s_shown_name_text == text) {
+        return false;
+    }
+    s_shown_name_text = text;
+    return true;
+}
+
+// Force every cached line to be formatted again on next use
+static void invalidate_text_cache() {
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        s_text_cache[i].mode_key = TEXT_CACHE_INVALID;
+        s_text_cache[i].name_minutes = TEXT_CACHE_INVALID;
+    }
+    s_shown_mode_text = NULL;
+    s_shown_name_text = NULL;
+}
+
+static void render_commit();
+
+// Load a fresh stage duration into a stopped timer
+static void set_timer_duration(TimerState *timer, int seconds) {
+    timer->seconds_remaining = seconds;
+    timer->remaining_ms = (int32_t)seconds * 1000;
+}
+
+// Milliseconds left in the current stage, derived from the deadline while running
+static int32_t get_remaining_ms(TimerState *timer, int64_t now) {
+    if (!timer->running) {
+        return timer->remaining_ms;
+    }
+    int64_t remaining = timer->deadline_ms - now;
+    return remaining > 0 ? (int32_t)remaining : 0;
+}
+
+// Precompute when each stage of an auto-advanced process ends, in seconds
+// from the start of Develop, with a drain gap before every later stage
+static void build_process_schedule(TimerState *timer) {
+    TimerConfig config = get_timer_config(timer->id, timer->mode);
+    uint16_t end = 0;
+    
+    timer->gap_s = s_settings.drain_gap_s;
+    for (int i = 0; i < config.stage_count; i++) {
+        end += (i > 0 ? timer->gap_s : 0) + config.timing_array[i];
+        timer->stage_end_s[i] = end;
+    }
+}
+
+// Offset into the schedule that the current deadline corresponds to
+static int32_t get_transition_offset_s(TimerState *timer) {
+    if (timer->draining) {
+        return timer->stage_end_s[timer->stage - 1] + timer->gap_s;
+    }
+    return timer->stage_end_s[timer->stage];
+}
+
+// Whole-process time left: the current countdown plus the rest of the schedule
+static int32_t get_process_remaining_ms(TimerState *timer, int64_t now) {
+    int32_t after = timer->stage_end_s[timer->max_stages - 1] - get_transition_offset_s(timer);
+    return get_remaining_ms(timer, now) + after * 1000;
+}
+
+// Stage indicators: one bar (or arc on round screens) per stage, the
+// current one filling in with elapsed time
+#define INDICATOR_SPACING 2
+
+static int get_indicator_width(GRect bounds, int max_stages) {
+    return (bounds.size.w - (max_stages - 1) * INDICATOR_SPACING) / max_stages;
+}
+
+// Elapsed part of the current stage in steps (bar pixels or ring degrees).
+// Nothing has elapsed before the stage starts or during a drain gap.
+static int get_stage_progress(TimerState *timer, int64_t now, int steps) {
+    TimerConfig config = get_timer_config(timer->id, timer->mode);
+    int32_t duration_ms = (int32_t)config.timing_array[timer->stage] * 1000;
+    int32_t elapsed_ms = duration_ms - get_remaining_ms(timer, now);
+    if (timer->draining || duration_ms <= 0 || elapsed_ms <= 0) {
+        return 0;
+    }
+    if (elapsed_ms >= duration_ms) {
+        return steps;
+    }
+    return (int)((int64_t)elapsed_ms * steps / duration_ms);
+}
+
+#if defined(PBL_ROUND)
+#define RING_THICKNESS 6
+#define RING_TRACK_THICKNESS 2
+#define RING_GAP_DEG 4
+
+// Start angle of each stage's arc, rebuilt only when the stage count changes
+static int32_t s_ring_starts[MAX_STAGES];
+static int s_ring_segment_deg;
+static int s_ring_stages = 0;
+
+static void build_ring_segments(int max_stages) {
+    if (max_stages == s_ring_stages) {
+        return;
+    }
+    s_ring_segment_deg = (360 - max_stages * RING_GAP_DEG) / max_stages;
+    for (int i = 0; i < max_stages; i++) {
+        s_ring_starts[i] = DEG_TO_TRIGANGLE(i * (s_ring_segment_deg + RING_GAP_DEG) + RING_GAP_DEG / 2);
+    }
+    s_ring_stages = max_stages;
+}
+#endif
+
+// Steps the current stage fills in the single view: pixels of its bar, or
+// degrees of its arc on round screens
+static int get_progress_steps(TimerState *timer) {
+#if defined(PBL_ROUND)
+    build_ring_segments(timer->max_stages);
+    return s_ring_segment_deg;
+#else
+    return get_indicator_width(s_layout.indicators, timer->max_stages);
+#endif
+}
+
+// Only a fill that crossed into a new pixel column (or degree) needs a frame
+static bool update_progress() {
+    TimerState *timer = get_active_timer();
+    int progress = get_stage_progress(timer, now_ms(), get_progress_steps(timer));
+    if (progress == s_shown_progress) {
+        return false;
+    }
+    s_shown_progress = progress;
+    return true;
+}
+
+// AppTimer delays run on the monotonic system tick and a callback never
+// fires before its delay has elapsed, so a tick whose wall-clock gap is
+// well short of the armed delay means the clock itself moved back (a phone
+// time resync). Shift every running deadline by the jump to keep the
+// remaining times; heap order is unaffected since all keys move together.
+// A gap longer than the delay is indistinguishable from late delivery by a
+// stalled event loop, and the wall-clock deadlines are already right for
+// that, so it is left alone: stages end on time however late the tick is.
+static void correct_clock_jump(int64_t now) {
+    int64_t drift = (now - s_tick_armed_ms) - s_tick_delay_ms;
+    if (drift >= -CLOCK_JUMP_TOLERANCE_MS) {
+        return;
+    }
+    for (int i = 0; i < s_heap_size; i++) {
+        TimerState *timer = &s_timers[s_event_heap[i]];
+        timer->deadline_ms += drift;
+        timer->next_event_ms += drift;
+        timer->cue_ms += drift;
+    }
+    journal_write();
+}
+
+// Delay until the displayed second of a countdown changes
+static uint32_t get_tick_delay(int32_t remaining) {
+    uint32_t delay = remaining % 1000;
+    return delay == 0 ? 1000 : delay;
+}
+
+// Delay until the displayed minute of a countdown changes. The final
+// minute starts on one of these boundaries, so the switch to seconds lands
+// exactly on it.
+static uint32_t get_minute_tick_delay(int32_t remaining) {
+    uint32_t delay = remaining % FINAL_MINUTE_MS;
+    return delay == 0 ? FINAL_MINUTE_MS : delay;
+}
+
+// Plan the next cue of a running stage. Cues are placed by remaining time,
+// so a pause only needs to drop the pending one and resuming replans it
+// against the new deadline.
+static void plan_next_cue(TimerState *timer, int64_t now) {
+    int32_t remaining = get_remaining_ms(timer, now);
+    int32_t cue_remaining = 0;
+    
+    timer->cue_kind = CUE_NONE;
+    if (timer->draining) {
+        return;
+    }
+    if (timer->mode == MODE_FILM && timer->stage == STAGE_DEVELOP) {
+        TimerConfig config = get_timer_config(timer->id, timer->mode);
+        int32_t elapsed = (int32_t)config.timing_array[timer->stage] * 1000 - remaining;
+        int32_t next_agitation = (elapsed / AGITATION_INTERVAL_MS + 1) * AGITATION_INTERVAL_MS;
+        cue_remaining = (int32_t)config.timing_array[timer->stage] * 1000 - next_agitation;
+        if (cue_remaining > PRE_END_WARNING_MS) {
+            timer->cue_kind = CUE_AGITATE;
+        }
+    }
+    if (timer->cue_kind == CUE_NONE && remaining > PRE_END_WARNING_MS) {
+        cue_remaining = PRE_END_WARNING_MS;
+        timer->cue_kind = CUE_WARNING;
+    }
+    timer->cue_ms = timer->deadline_ms - cue_remaining;
+}
+
+// Drop any pending cue (pause, reset, stage scroll)
+static void cancel_cues(TimerState *timer) {
+    timer->cue_kind = CUE_NONE;
+}
+
+static void fire_cue(TimerState *timer) {
+    CueKind kind = timer->cue_kind;
+    timer->cue_kind = CUE_NONE;
+    if (!s_settings.vibration_enabled) {
+        return;
+    }
+    
+    switch (kind) {
+        case CUE_AGITATE:
+            vibes_short_pulse();
+            break;
+        case CUE_WARNING:
+            vibes_long_pulse();
+            break;
+        case CUE_REMINDER:
+            // Only remind if the user hasn't started the waiting stage yet
+            if (!timer->running) {
+                if (timer->id % 2 == 1) {
+                    // Odd timers: single pulse when waiting
+                    vibes_short_pulse();
+                } else {
+                    // Even timers: double pulse when waiting
+                    vibes_double_pulse();
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// A timer stays on the event heap while it is running or has a cue pending
+static bool has_pending_events(TimerState *timer) {
+    return timer->running || timer->cue_kind != CUE_NONE;
+}
+
+// Displayed timers need every boundary of their current resolution;
+// timers in the background, or all of them while the main window is
+// covered, only need their deadline. A pending cue comes first if it is
+// earlier.
+static int64_t get_next_event_ms(TimerState *timer, int64_t now) {
+    int64_t next;
+    if (!timer->running) {
+        return timer->cue_ms;
+    } else if (!is_timer_displayed(timer)) {
+        next = timer->deadline_ms;
+    } else if (use_minute_resolution(timer, now)) {
+        next = now + get_minute_tick_delay(get_remaining_ms(timer, now));
+    } else {
+        next = now + get_tick_delay(get_remaining_ms(timer, now));
+    }
+    if (timer->cue_kind != CUE_NONE && timer->cue_ms < next) {
+        next = timer->cue_ms;
+    }
+    return next;
+}
+
+static bool heap_less(int a, int b) {
+    return s_timers[s_event_heap[a]].next_event_ms < s_timers[s_event_heap[b]].next_event_ms;
+}
+
+static void heap_swap(int a, int b) {
+    uint8_t tmp = s_event_heap[a];
+    s_event_heap[a] = s_event_heap[b];
+    s_event_heap[b] = tmp;
+    s_heap_pos[s_event_heap[a]] = a;
+    s_heap_pos[s_event_heap[b]] = b;
+}
+
+static void heap_sift_up(int pos) {
+    while (pos > 0 && heap_less(pos, (pos - 1) / 2)) {
+        heap_swap(pos, (pos - 1) / 2);
+        pos = (pos - 1) / 2;
+    }
+}
+
+static void heap_sift_down(int pos) {
+    for (;;) {
+        int smallest = pos;
+        int left = 2 * pos + 1;
+        int right = left + 1;
+        if (left < s_heap_size && heap_less(left, smallest)) {
+            smallest = left;
+        }
+        if (right < s_heap_size && heap_less(right, smallest)) {
+            smallest = right;
+        }
+        if (smallest == pos) {
+            return;
+        }
+        heap_swap(pos, smallest);
+        pos = smallest;
+    }
+}
+
+static void heap_remove(int index) {
+    int pos = s_heap_pos[index];
+    if (pos < 0) {
+        return;
+    }
+    s_heap_size--;
+    if (pos != s_heap_size) {
+        heap_swap(pos, s_heap_size);
+        heap_sift_down(pos);
+        heap_sift_up(pos);
+    }
+    s_heap_pos[index] = -1;
+}
+
+// Insert or reposition a timer after its next_event_ms changed
+static void heap_update(int index) {
+    int pos = s_heap_pos[index];
+    if (pos < 0) {
+        pos = s_heap_size++;
+        s_event_heap[pos] = index;
+        s_heap_pos[index] = pos;
+    }
+    heap_sift_down(pos);
+    heap_sift_up(s_heap_pos[index]);
+}
+
+static void scheduler_tick(void *data);
+
+// Arm the shared tick for the earliest event in the heap
+static void scheduler_arm(int64_t now) {
+    if (s_heap_size == 0) {
+        if (s_tick_timer) {
+            app_timer_cancel(s_tick_timer);
+            s_tick_timer = NULL;
+        }
+        return;
+    }
+    
+    int64_t delay = s_timers[s_event_heap[0]].next_event_ms - now;
+    s_tick_armed_ms = now;
+    s_tick_delay_ms = delay > 0 ? (uint32_t)delay : 1;
+    if (!s_tick_timer || !app_timer_reschedule(s_tick_timer, s_tick_delay_ms)) {
+        s_tick_timer = app_timer_register(s_tick_delay_ms, scheduler_tick, NULL);
+    }
+}
+
+// Re-key one timer after its running state, deadline, or visibility changed
+static void scheduler_update(TimerState *timer, int64_t now) {
+    int index = timer->id - 1;
+    if (timer->running && timer->cue_kind == CUE_NONE) {
+        plan_next_cue(timer, now);
+    }
+    if (has_pending_events(timer)) {
+        timer->next_event_ms = get_next_event_ms(timer, now);
+        heap_update(index);
+    } else {
+        heap_remove(index);
+    }
+    scheduler_arm(now);
+}
+
+// Refresh and re-key the timers on screen after the view, the active timer
+// or the window's visibility changed
+static void update_displayed_timers(int64_t now) {
+    int shown[2] = { s_active_timer, get_split_partner(s_active_timer) };
+    for (int i = 0; i < 2 && shown[i] != 0; i++) {
+        TimerState *timer = &s_timers[shown[i] - 1];
+        if (timer->running) {
+            timer->seconds_remaining = (get_remaining_ms(timer, now) + 999) / 1000;
+        }
+        scheduler_update(timer, now);
+    }
+}
+
+// The worker is launched at most once per session. When another app's
+// worker holds the slot the system asks before replacing it; a refusal is
+// remembered, and from then on running stages rely on wakeups alone.
+static bool s_worker_launch_requested = false;
+static bool s_worker_confirmation_pending = false;
+static bool s_worker_declined = false;
+
+static void launch_worker() {
+    if (s_worker_launch_requested || s_worker_declined || app_worker_is_running()) {
+        return;
+    }
+    s_worker_launch_requested = true;
+    
+    AppWorkerResult result = app_worker_launch();
+    if (result == APP_WORKER_RESULT_ASKING_CONFIRMATION) {
+        s_worker_confirmation_pending = true;
+    } else if (result != APP_WORKER_RESULT_SUCCESS && result != APP_WORKER_RESULT_ALREADY_RUNNING) {
+        APP_LOG(APP_LOG_LEVEL_WARNING, "Worker not launched: %d", (int)result);
+    }
+}
+
+// Called once the confirmation dialog is gone: no worker means it was declined
+static void resolve_worker_confirmation() {
+    if (!s_worker_confirmation_pending) {
+        return;
+    }
+    s_worker_confirmation_pending = false;
+    if (!app_worker_is_running()) {
+        s_worker_declined = true;
+        persist_write_bool(WORKER_DECLINED_KEY, true);
+    }
+}
+
+// Start (or resume) counting down the banked time against a fresh deadline
+static void start_timer(TimerState *timer) {
+    int64_t now = now_ms();
+    
+    // A fresh start picks up the auto-advance setting; a resume keeps its schedule
+    if (!timer->paused) {
+        timer->auto_advance = s_settings.auto_advance;
+        timer->draining = false;
+        if (timer->auto_advance) {
+            build_process_schedule(timer);
+        }
+    }
+    timer->running = true;
+    timer->paused = false;
+    timer->deadline_ms = now + timer->remaining_ms;
+    cancel_cues(timer);
+    scheduler_update(timer, now);
+    journal_write();
+    
+    // Bring the worker up now so it is ready to take over when the app closes
+    launch_worker();
+}
+
+// Bring one running timer up to date, completing its stage if the deadline passed
+static void service_timer(TimerState *timer, int64_t now) {
+    int32_t remaining = get_remaining_ms(timer, now);
+    
+    if (remaining > 0) {
+        timer->seconds_remaining = (remaining + 999) / 1000;
+        return;
+    }
+    
+    // Get timer configuration to determine max stages and timing
+    TimerConfig config = get_timer_config(timer->id, timer->mode);
+    
+    if (timer->draining) {
+        // Drain gap over: the stage itself starts on schedule, no input needed
+        timer->draining = false;
+        timer->deadline_ms += (int64_t)config.timing_array[timer->stage] * 1000;
+        timer->seconds_remaining = (get_remaining_ms(timer, now) + 999) / 1000;
+        journal_write();
+        return;
+    }
+    
+    // Vibrate when a stage completes - pattern depends on which timer
+    if (s_settings.vibration_enabled) {
+        if (timer->id % 2 == 1) {
+            // Odd timers: single pulse when finished
+            vibes_short_pulse();
+        } else {
+            // Even timers: double pulse when finished
+            vibes_double_pulse();
+        }
+    }
+    
+    // Move to next stage
+    timer->stage++;
+    
+    TimerStage max_stage;
+    
+    if (timer->mode == MODE_FILM) {
+        max_stage = STAGE_WASH; // Film always has 4 stages ending at STAGE_WASH
+    } else if (timer->paper_type == PAPER_RC) {
+        max_stage = STAGE_WASH; // RC paper has 4 stages ending at STAGE_WASH
+    } else {
+        max_stage = STAGE_WASH2; // Fiber paper has 6 stages ending at STAGE_WASH2
+    }
+    
+    if (timer->stage > max_stage) {
+        timer->stage = STAGE_DEVELOP;
+        timer->running = false;
+        timer->auto_advance = false;
+        cancel_cues(timer);
+        set_timer_duration(timer, 0);
+    } else if (timer->auto_advance) {
+        // Keep running from the schedule: drain gap first, then the stage.
+        // Deadlines advance from the previous one, so late ticks don't drift.
+        int seconds = timer->gap_s;
+        timer->draining = timer->gap_s > 0;
+        if (!timer->draining) {
+            seconds = config.timing_array[timer->stage];
+        }
+        timer->deadline_ms += (int64_t)seconds * 1000;
+        timer->seconds_remaining = (get_remaining_ms(timer, now) + 999) / 1000;
+    } else {
+        // Set the time for the next stage but don't start it automatically
+        set_timer_duration(timer, config.timing_array[timer->stage]);
+        timer->running = false;
+        
+        // Remind the user shortly after if the next stage is still waiting
+        timer->cue_kind = CUE_REMINDER;
+        timer->cue_ms = now + STAGE_REMINDER_MS;
+    }
+    journal_write();
+}
+
+// Shared tick: service only the timers whose event is due, then redraw once
+static void scheduler_tick(void *data) {
+    s_tick_timer = NULL;
+    s_tick_count++;
+    
+    int64_t now = now_ms();
+    correct_clock_jump(now);
+    
+    while (s_heap_size > 0 && s_timers[s_event_heap[0]].next_event_ms <= now) {
+        int index = s_event_heap[0];
+        TimerState *timer = &s_timers[index];
+        TimerStage stage = timer->stage;
+        bool was_running = timer->running;
+        bool was_draining = timer->draining;
+        if (timer->cue_kind != CUE_NONE && timer->cue_ms <= now) {
+            fire_cue(timer);
+        }
+        if (timer->running) {
+            service_timer(timer, now);
+        }
+        
+        if (timer->running && timer->cue_kind == CUE_NONE) {
+            plan_next_cue(timer, now);
+        }
+        if (has_pending_events(timer)) {
+            timer->next_event_ms = get_next_event_ms(timer, now);
+            heap_sift_down(0);
+        } else {
+            heap_remove(index);
+        }
+        
+        if (is_timer_displayed(timer) && was_running) {
+            s_dirty |= DIRTY_TIME;
+            if (timer->stage != stage || !timer->running || timer->draining != was_draining) {
+                s_dirty |= DIRTY_MODE | DIRTY_NAME;
+            } else if (timer->auto_advance) {
+                s_dirty |= DIRTY_NAME;  // Whole-process minutes
+            }
+        }
+    }
+    render_commit();
+    
+    scheduler_arm(now);
+}
+
+// Hand running stages over to the Wakeup API so the app can close during
+// long washes and be relaunched exactly when the next stage completes
+static void schedule_stage_wakeups() {
+    // Register earliest deadlines first: the system refuses wakeups closer
+    // than a minute apart, and the earlier relaunch covers the later one
+    bool scheduled[MAX_TIMERS] = { false };
+    for (int n = 0; n < MAX_TIMERS; n++) {
+        int next = -1;
+        for (int i = 0; i < MAX_TIMERS; i++) {
+            if (s_timers[i].running && !scheduled[i] &&
+                (next < 0 || s_timers[i].deadline_ms < s_timers[next].deadline_ms)) {
+                next = i;
+            }
+        }
+        if (next < 0) {
+            break;
+        }
+        scheduled[next] = true;
+        
+        time_t wake_time = (time_t)((s_timers[next].deadline_ms + 999) / 1000);
+        WakeupId id = wakeup_schedule(wake_time, next + 1, true);
+        if (id < 0) {
+            APP_LOG(APP_LOG_LEVEL_WARNING, "Wakeup for timer %d not scheduled: %d",
+                    next + 1, (int)id);
+        }
+    }
+}
+
+// Restore every timer from the journal, catching up the time that passed
+// while the app was closed (or crashed). Stages whose deadline passed complete
+// right away, with vibration, so the first frame already shows the correct
+// remaining time. While a worker's records are still on their way the
+// timers are only shown: the worker completes and reschedules them itself.
+static void restore_timer_state(bool resume) {
+    wakeup_cancel_all();
+    
+    if (!s_journal_valid) {
+        return;
+    }
+    // Work on a copy: completing a stage below journals over s_journal
+    TimerSnapshot snapshots[MAX_TIMERS];
+    memcpy(snapshots, s_journal.timers, sizeof(snapshots));
+    
+    // A wakeup launch goes straight to the timer whose stage just completed
+    WakeupId wakeup_id;
+    int32_t cookie;
+    if (launch_reason() == APP_LAUNCH_WAKEUP &&
+        wakeup_get_launch_event(&wakeup_id, &cookie) &&
+        cookie >= 1 && cookie <= s_settings.timer_count) {
+        s_active_timer = cookie;
+    }
+    
+    int64_t now = now_ms();
+    for (int i = 0; i < s_settings.timer_count; i++) {
+        TimerSnapshot *snapshot = &snapshots[i];
+        TimerState *timer = &s_timers[i];
+        TimerConfig config = get_timer_config(i + 1, (TimerMode)snapshot->mode);
+        timer->mode = (TimerMode)snapshot->mode;
+        timer->paper_type = (PaperType)snapshot->paper_type;
+        timer->max_stages = config.stage_count;
+        timer->stage = (TimerStage)snapshot->stage;
+        timer->running = snapshot->running;
+        timer->paused = snapshot->paused;
+        timer->auto_advance = snapshot->auto_advance;
+        timer->draining = snapshot->draining;
+        if (timer->auto_advance) {
+            build_process_schedule(timer);
+        }
+        set_timer_duration(timer, 0);
+        timer->remaining_ms = snapshot->remaining_ms;
+        timer->deadline_ms = snapshot->deadline_ms;
+        
+        // Catch up: a running stage reads its remaining time from the deadline,
+        // and an auto-advanced process walks through every transition it missed
+        int32_t remaining = get_remaining_ms(timer, now);
+        timer->seconds_remaining = (remaining + 999) / 1000;
+        if (timer->running && resume) {
+            do {
+                service_timer(timer, now);
+            } while (timer->running && get_remaining_ms(timer, now) == 0);
+            scheduler_update(timer, now);
+        }
+    }
+    
+    s_dirty = DIRTY_ALL;
+    render_commit();
+}
+
+// Pack one timer into a worker record
+static void send_worker_record(TimerState *timer, int64_t now) {
+    uint16_t flags = (uint16_t)(timer->id - 1) |
+                     (uint16_t)(timer->stage << WORKER_RECORD_STAGE_SHIFT);
+    if (timer->mode == MODE_FILM) {
+        flags |= WORKER_RECORD_FILM;
+    }
+    if (timer->paper_type == PAPER_FIBER) {
+        flags |= WORKER_RECORD_FIBER;
+    }
+    if (timer->running) {
+        flags |= WORKER_RECORD_RUNNING;
+    }
+    if (timer->paused) {
+        flags |= WORKER_RECORD_PAUSED;
+    }
+    if (timer->auto_advance) {
+        flags |= WORKER_RECORD_AUTO;
+    }
+    if (timer->draining) {
+        flags |= WORKER_RECORD_DRAINING;
+    }
+    
+    uint32_t remaining = (uint32_t)get_remaining_ms(timer, now);
+    AppWorkerMessage message = {
+        .data0 = flags,
+        .data1 = (uint16_t)(remaining & 0xFFFF),
+        .data2 = (uint16_t)(remaining >> 16)
+    };
+    app_worker_send_message(WORKER_MSG_TIMER, &message);
+}
+
+// Hand the countdowns to the background worker on exit. Returns false when
+// there is nothing to hand over or no worker to take it.
+static bool detach_from_worker() {
+    bool any_active = false;
+    for (int i = 0; i < s_settings.timer_count; i++) {
+        any_active |= s_timers[i].running || s_timers[i].paused;
+    }
+    
+    if (!any_active) {
+        app_worker_kill();
+        return false;
+    }
+    if (!app_worker_is_running()) {
+        return false;
+    }
+    
+    int64_t now = now_ms();
+    for (int i = 0; i < s_settings.timer_count; i++) {
+        send_worker_record(&s_timers[i], now);
+    }
+    AppWorkerMessage message = {0};
+    app_worker_send_message(WORKER_MSG_DETACH, &message);
+    return true;
+}
+
+// Adopt one record sent back by the worker. A stage that completed while
+// the app was closed finishes here, with vibration.
+static void apply_worker_record(AppWorkerMessage *message, int64_t now) {
+    int index = message->data0 & WORKER_RECORD_INDEX_MASK;
+    if (index >= s_settings.timer_count) {
+        return;
+    }
+    
+    uint16_t flags = message->data0;
+    TimerState *timer = &s_timers[index];
+    timer->mode = (flags & WORKER_RECORD_FILM) ? MODE_FILM : MODE_PRINT;
+    timer->paper_type = (flags & WORKER_RECORD_FIBER) ? PAPER_FIBER : PAPER_RC;
+    timer->max_stages = get_timer_config(timer->id, timer->mode).stage_count;
+    timer->stage = (TimerStage)((flags & WORKER_RECORD_STAGE_MASK) >> WORKER_RECORD_STAGE_SHIFT);
+    timer->paused = (flags & WORKER_RECORD_PAUSED) != 0;
+    timer->running = (flags & (WORKER_RECORD_RUNNING | WORKER_RECORD_COMPLETED)) != 0;
+    timer->auto_advance = (flags & WORKER_RECORD_AUTO) != 0;
+    timer->draining = (flags & WORKER_RECORD_DRAINING) != 0;
+    if (timer->auto_advance) {
+        build_process_schedule(timer);
+    }
+    timer->remaining_ms = WORKER_RECORD_REMAINING(message);
+    timer->seconds_remaining = (timer->remaining_ms + 999) / 1000;
+    timer->deadline_ms = now + timer->remaining_ms;
+    
+    if (flags & WORKER_RECORD_COMPLETED) {
+        s_active_timer = timer->id;
+        service_timer(timer, now);
+    }
+    scheduler_update(timer, now);
+}
+
+// Records received since attaching. A worker that was never handed the
+// timers (the app crashed or the watch reset mid-stage) answers with none.
+static int s_worker_records = 0;
+
+static void worker_message_handler(uint16_t type, AppWorkerMessage *message) {
+    if (type == WORKER_MSG_TIMER) {
+        s_worker_records++;
+        apply_worker_record(message, now_ms());
+    } else if (type == WORKER_MSG_SYNC_DONE) {
+        if (s_worker_records == 0) {
+            // Nothing was handed over: the journal has the timers
+            restore_timer_state(true);
+            return;
+        }
+        s_dirty = DIRTY_ALL;
+        render_commit();
+    }
+}
+
+// Take the countdowns back from a worker left running by a previous session
+static void attach_to_worker() {
+    wakeup_cancel_all();
+    s_worker_records = 0;
+    
+    AppWorkerMessage message = {0};
+    app_worker_send_message(WORKER_MSG_ATTACH, &message);
+}
+
+static void set_timer_count(int count);
+
+// Settings menu, generated from the const tables below: each row names the
+// value it shows, how to format it, and how selecting it edits the value
+typedef enum {
+    MENU_EDIT_TOGGLE,           // bool flipped on select
+    MENU_EDIT_CYCLE,            // uint8_t stepped from min to max, then wrapping
+    MENU_EDIT_TIME              // Stage time in seconds, adjusted in its own window
+} MenuEditor;
+
+typedef struct MenuRow MenuRow;
+typedef void (*MenuRowFormatter)(const MenuRow *row, char *buffer, size_t size);
+
+struct MenuRow {
+    const char *label;
+    void *value;
+    MenuRowFormatter format;
+    MenuEditor editor;
+    uint8_t min, max, step;     // MENU_EDIT_CYCLE only
+    void (*changed)(void);      // Applies the new value, if it needs more than storing
+};
+
+typedef struct {
+    const char *title;
+    const MenuRow *rows;
+    uint16_t row_count;
+} MenuSection;
+
+static void format_on_off(const MenuRow *row, char *buffer, size_t size) {
+    snprintf(buffer, size, "%s: %s", row->label, *(bool *)row->value ? "On" : "Off");
+}
+
+static void format_count(const MenuRow *row, char *buffer, size_t size) {
+    snprintf(buffer, size, "%s: %d", row->label, *(uint8_t *)row->value);
+}
+
+static void format_seconds(const MenuRow *row, char *buffer, size_t size) {
+    snprintf(buffer, size, "%s: %ds", row->label, *(uint8_t *)row->value);
+}
+
+static void format_stage_time(const MenuRow *row, char *buffer, size_t size) {
+    int seconds = *(int *)row->value;
+    snprintf(buffer, size, "%s: %d:%02d", row->label, seconds / 60, seconds % 60);
+}
+
+static void apply_backlight() {
+    light_enable(s_settings.backlight_enabled);
+}
+
+// The Timers row edits a copy that is applied when the menu closes: cycling
+// through the values would otherwise reset every timer above each step
+static uint8_t s_menu_timer_count;
+
+static void apply_menu_colors() {
+    if (s_settings.invert_menu_colors) {
+        window_set_background_color(s_menu_window, GColorBlack);
+        menu_layer_set_normal_colors(s_menu_layer, GColorBlack, GColorWhite);
+        menu_layer_set_highlight_colors(s_menu_layer, GColorWhite, GColorBlack);
+    } else {
+        window_set_background_color(s_menu_window, GColorWhite);
+        menu_layer_set_normal_colors(s_menu_layer, GColorWhite, GColorBlack);
+        menu_layer_set_highlight_colors(s_menu_layer, GColorBlack, GColorWhite);
+    }
+}
+
+#define STAGE_TIME_ROW(label, value) { label, value, format_stage_time, MENU_EDIT_TIME, 0, 0, 0, NULL }
+
+static const MenuRow s_basic_rows[] = {
+    { "Vibration", &s_settings.vibration_enabled, format_on_off, MENU_EDIT_TOGGLE, 0, 0, 0, NULL },
+    { "Backlight", &s_settings.backlight_enabled, format_on_off, MENU_EDIT_TOGGLE, 0, 0, 0, apply_backlight },
+    { "Timers", &s_menu_timer_count, format_count, MENU_EDIT_CYCLE, 1, MAX_TIMERS, 1, NULL },
+    // Takes effect the next time a process starts
+    { "Auto-advance", &s_settings.auto_advance, format_on_off, MENU_EDIT_TOGGLE, 0, 0, 0, NULL },
+    { "Drain gap", &s_settings.drain_gap_s, format_seconds, MENU_EDIT_CYCLE,
+      0, MAX_DRAIN_GAP_S, DRAIN_GAP_STEP_S, NULL },
+    { "Split view", &s_settings.split_view, format_on_off, MENU_EDIT_TOGGLE, 0, 0, 0, NULL }
 };
 
-// Timer settings (in seconds)
-static int film_times[4] = {
-    300,  // Develop: 5 mins
-    60,   // Stop: 1 min
-    300,  // Fix: 5 mins
-    300   // Wash: 5 mins
+static const MenuRow s_display_rows[] = {
+    { "Invert Timer 1", &s_settings.invert_timer1_colors, format_on_off, MENU_EDIT_TOGGLE,
+      0, 0, 0, resolve_display_themes },
+    { "Invert Timer 2", &s_settings.invert_timer2_colors, format_on_off, MENU_EDIT_TOGGLE,
+      0, 0, 0, resolve_display_themes },
+    { "Invert Menu", &s_settings.invert_menu_colors, format_on_off, MENU_EDIT_TOGGLE,
+      0, 0, 0, apply_menu_colors }
 };
 
-// RC paper timing (4 stages)
-static int rc_print_times[4] = {
-    60,   // Develop: 1 min
-    30,   // Stop: 30 secs
-    300,  // Fix: 5 mins
-    300   // Wash: 5 mins
+static const MenuRow s_film_rows[] = {
+    STAGE_TIME_ROW("Develop", &film_times[0]),
+    STAGE_TIME_ROW("Stop", &film_times[1]),
+    STAGE_TIME_ROW("Fix", &film_times[2]),
+    STAGE_TIME_ROW("Wash", &film_times[3])
 };
 
-// Fiber paper timing (6 stages)
-static int fiber_print_times[6] = {
-    120,  // Develop: 2 min
-    30,   // Stop: 30 sec
-    120,  // Fix: 2 min
-    300,  // Wash: 5 min
-    120,  // Hypo Clear: 2 min
-    900   // Wash2: 15 min
+static const MenuRow s_rc_rows[] = {
+    STAGE_TIME_ROW("Develop", &rc_print_times[0]),
+    STAGE_TIME_ROW("Stop", &rc_print_times[1]),
+    STAGE_TIME_ROW("Fix", &rc_print_times[2]),
+    STAGE_TIME_ROW("Wash", &rc_print_times[3])
 };
 
-// Persistent storage functions
-static void save_settings() {
-    persist_write_data(SETTINGS_KEY, &s_settings, sizeof(Settings));
-    persist_write_data(FILM_TIMES_KEY, &film_times, sizeof(film_times));
-    persist_write_data(RC_PRINT_TIMES_KEY, &rc_print_times, sizeof(rc_print_times));
-    persist_write_data(FIBER_PRINT_TIMES_KEY, &fiber_print_times, sizeof(fiber_print_times));
+static const MenuRow s_fiber_rows[] = {
+    STAGE_TIME_ROW("Develop", &fiber_print_times[0]),
+    STAGE_TIME_ROW("Stop", &fiber_print_times[1]),
+    STAGE_TIME_ROW("Fix", &fiber_print_times[2]),
+    STAGE_TIME_ROW("Wash", &fiber_print_times[3]),
+    STAGE_TIME_ROW("HC", &fiber_print_times[4]),
+    STAGE_TIME_ROW("Wash2", &fiber_print_times[5])
+};
+
+static const MenuSection s_menu_sections[] = {
+    { "Basic Settings", s_basic_rows, ARRAY_LENGTH(s_basic_rows) },
+    { "Display Settings", s_display_rows, ARRAY_LENGTH(s_display_rows) },
+    { "Film Times", s_film_rows, ARRAY_LENGTH(s_film_rows) },
+    { "RC Print Times", s_rc_rows, ARRAY_LENGTH(s_rc_rows) },
+    { "Fiber Print Times", s_fiber_rows, ARRAY_LENGTH(s_fiber_rows) }
+};
+
+static const MenuRow *get_menu_row(MenuIndex *cell_index) {
+    return &s_menu_sections[cell_index->section].rows[cell_index->row];
 }
 
-static void load_settings() {
-    if (persist_exists(SETTINGS_KEY)) {
-        persist_read_data(SETTINGS_KEY, &s_settings, sizeof(Settings));
-    }
-    if (persist_exists(FILM_TIMES_KEY)) {
-        persist_read_data(FILM_TIMES_KEY, &film_times, sizeof(film_times));
-    }
+// Stage time editor: one window, created on first use and reused for every
+// edit. UP/DOWN adjust the selected field, minutes or seconds, and speed up
+// while held; SELECT moves from minutes to seconds and then closes. The
+// value is written back when the editor closes, by SELECT or BACK.
+#define TIME_EDITOR_REPEAT_MS 100
+#define TIME_EDITOR_MAX_S (99 * 60 + 59)
+
+typedef struct {
+    Window *window;
+    Layer *layer;
+    const char *label;
+    int *target;                // Timing array entry being edited
+    int value;                  // Seconds
+    bool editing_seconds;
+} TimeEditor;
+
+static TimeEditor s_time_editor;
+
+// Held buttons step 1, then 5, then 10 units; accelerated second steps
+// snap to multiples of the step
+static int get_time_editor_step(int repeats) {
+    return repeats < 8 ? 1 : (repeats < 20 ? 5 : 10);
+}
+
+static void adjust_time_editor(int direction, int repeats) {
+    int step = get_time_editor_step(repeats);
+    int value = s_time_editor.value;
     
-    // Load RC and Fiber timing arrays
-    if (persist_exists(RC_PRINT_TIMES_KEY)) {
-        persist_read_data(RC_PRINT_TIMES_KEY, &rc_print_times, sizeof(rc_print_times));
+    if (s_time_editor.editing_seconds) {
+        value = (value / step) * step + (direction > 0 || value % step == 0 ? direction * step : 0);
+    } else {
+        value += direction * step * 60;
     }
-    
-    if (persist_exists(FIBER_PRINT_TIMES_KEY)) {
-        persist_read_data(FIBER_PRINT_TIMES_KEY, &fiber_print_times, sizeof(fiber_print_times));
+    if (value < 1) {
+        value = 1;
+    } else if (value > TIME_EDITOR_MAX_S) {
+        value = TIME_EDITOR_MAX_S;
+    }
+    if (value != s_time_editor.value) {
+        s_time_editor.value = value;
+        layer_mark_dirty(s_time_editor.layer);
     }
 }
 
-// Timer configuration structure
-typedef struct {
-    TimerMode mode;
-    PaperType paper_type;
-    int *timing_array;
-    int stage_count;
-    const char *paper_name;
-} TimerConfig;
+static void time_editor_up_handler(ClickRecognizerRef recognizer, void *context) {
+    adjust_time_editor(1, click_number_of_clicks_counted(recognizer));
+}
 
-// Timer configuration lookup helper function
-static TimerConfig get_timer_config(int timer_number, TimerMode mode) {
-    if (mode == MODE_FILM) {
-        return (TimerConfig){
-            .mode = MODE_FILM,
-            .paper_type = PAPER_RC, // Not applicable for film
-            .timing_array = film_times,
-            .stage_count = 4,
-            .paper_name = "Film"
-        };
-    } else {
-        // Timer 1 = RC, Timer 2 = Fiber
-        if (timer_number == 1) {
-            return (TimerConfig){
-                .mode = MODE_PRINT,
-                .paper_type = PAPER_RC,
-                .timing_array = rc_print_times,
-                .stage_count = 4,
-                .paper_name = "RC"
-            };
-        } else {
-            return (TimerConfig){
-                .mode = MODE_PRINT,
-                .paper_type = PAPER_FIBER,
-                .timing_array = fiber_print_times,
-                .stage_count = 6,
-                .paper_name = "FB"
-            };
-        }
-    }
+static void time_editor_down_handler(ClickRecognizerRef recognizer, void *context) {
+    adjust_time_editor(-1, click_number_of_clicks_counted(recognizer));
 }
 
-static TimerState* get_active_timer() {
-    return s_active_timer == 1 ? &s_timer1 : &s_timer2;
+static void time_editor_select_handler(ClickRecognizerRef recognizer, void *context) {
+    if (!s_time_editor.editing_seconds) {
+        s_time_editor.editing_seconds = true;
+        layer_mark_dirty(s_time_editor.layer);
+    } else {
+        window_stack_pop(true);
+    }
 }
 
-static void update_timer_text() {
-    TimerState *timer = get_active_timer();
-    static char s_buffer[8];
-    int minutes = timer->seconds_remaining / 60;
-    int seconds = timer->seconds_remaining % 60;
-    snprintf(s_buffer, sizeof(s_buffer), "%02d:%02d", minutes, seconds);
-    text_layer_set_text(s_timer_layer, s_buffer);
+static void time_editor_click_config_provider(void *context) {
+    window_single_repeating_click_subscribe(BUTTON_ID_UP, TIME_EDITOR_REPEAT_MS, time_editor_up_handler);
+    window_single_repeating_click_subscribe(BUTTON_ID_DOWN, TIME_EDITOR_REPEAT_MS, time_editor_down_handler);
+    window_single_click_subscribe(BUTTON_ID_SELECT, time_editor_select_handler);
 }
 
-static void update_mode_text() {
-    TimerState *timer = get_active_timer();
-    static char s_buffer[32];
-    char mode_char = (timer->mode == MODE_FILM) ? 'F' : 'P';
+static void time_editor_update_proc(Layer *layer, GContext *ctx) {
+    GRect bounds = layer_get_bounds(layer);
+    GFont label_font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
+    GFont field_font = fonts_get_system_font(FONT_KEY_BITHAM_42_BOLD);
+    int field_width = bounds.size.w / 2 - 8;
+    int field_y = bounds.size.h / 2 - 26;
+    GRect minutes_rect = GRect(0, field_y, field_width, 50);
+    GRect colon_rect = GRect(field_width, field_y, 16, 50);
+    GRect seconds_rect = GRect(field_width + 16, field_y, field_width, 50);
+    char minutes[3];
+    char seconds[3];
     
-    // Get paper type string
-    const char *paper_type = "Film";
-    if (timer->mode == MODE_PRINT) {
-        paper_type = (timer->paper_type == PAPER_RC) ? "RC" : "FB";
-    }
+    snprintf(minutes, sizeof(minutes), "%02d", s_time_editor.value / 60);
+    snprintf(seconds, sizeof(seconds), "%02d", s_time_editor.value % 60);
     
-    // Get stage text
-    const char *stage_text = "Unknown";
-    switch (timer->stage) {
-        case STAGE_DEVELOP: stage_text = "Dev"; break;
-        case STAGE_STOP: stage_text = "Stop"; break;
-        case STAGE_FIX: stage_text = "Fix"; break;
-        case STAGE_WASH: stage_text = "Wash"; break;
-        case STAGE_HYPO_CLEAR: stage_text = "HC"; break;
-        case STAGE_WASH2: stage_text = "Wash2"; break;
-    }
+    graphics_context_set_text_color(ctx, GColorBlack);
+    graphics_draw_text(ctx, s_time_editor.label, label_font,
+                       GRect(0, field_y - 40, bounds.size.w, 30),
+                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
+    graphics_draw_text(ctx, ":", field_font, colon_rect,
+                       GTextOverflowModeFill, GTextAlignmentCenter, NULL);
     
-    // Format: [P,F] | [RC,FB] | [Stage] | [Status]
-    const char *status = timer->paused ? "PAUSED" : (timer->running ? "RUNNING" : "");
-    if (strlen(status) > 0) {
-        snprintf(s_buffer, sizeof(s_buffer), "%c | %s | %s | %s", 
-                 mode_char, paper_type, stage_text, status);
-    } else {
-        snprintf(s_buffer, sizeof(s_buffer), "%c | %s | %s", 
-                 mode_char, paper_type, stage_text);
-    }
+    // The field being edited is drawn inverted
+    GRect selected = s_time_editor.editing_seconds ? seconds_rect : minutes_rect;
+    graphics_context_set_fill_color(ctx, GColorBlack);
+    graphics_fill_rect(ctx, GRect(selected.origin.x + 4, selected.origin.y + 8,
+                                  selected.size.w - 8, selected.size.h - 4), 4, GCornersAll);
     
-    text_layer_set_text(s_mode_layer, s_buffer);
+    graphics_context_set_text_color(ctx, s_time_editor.editing_seconds ? GColorBlack : GColorWhite);
+    graphics_draw_text(ctx, minutes, field_font, minutes_rect,
+                       GTextOverflowModeFill, GTextAlignmentCenter, NULL);
+    graphics_context_set_text_color(ctx, s_time_editor.editing_seconds ? GColorWhite : GColorBlack);
+    graphics_draw_text(ctx, seconds, field_font, seconds_rect,
+                       GTextOverflowModeFill, GTextAlignmentCenter, NULL);
 }
 
-static void update_timer_name_text() {
-    static char s_buffer[10];
-    snprintf(s_buffer, sizeof(s_buffer), "Timer %d", s_active_timer);
-    text_layer_set_text(s_timer_name_layer, s_buffer);
+static void time_editor_load(Window *window) {
+    Layer *window_layer = window_get_root_layer(window);
+    s_time_editor.layer = layer_create(layer_get_bounds(window_layer));
+    layer_set_update_proc(s_time_editor.layer, time_editor_update_proc);
+    layer_add_child(window_layer, s_time_editor.layer);
 }
 
-// Callback for delayed vibration reminder
-static void delayed_vibration_callback(void *data) {
-    TimerState *timer = (TimerState *)data;
-    
-    // Only vibrate if the timer is still not running (user hasn't started it yet)
-    if (!timer->running && s_settings.vibration_enabled) {
-        if (timer == &s_timer1) {
-            // Timer 1: single pulse when waiting
-            vibes_short_pulse();
-        } else {
-            // Timer 2: double pulse when waiting
-            vibes_double_pulse();
-        }
-    }
+static void time_editor_unload(Window *window) {
+    layer_destroy(s_time_editor.layer);
 }
 
-// Timer callback
-static void timer_callback(void *data) {
-    TimerState *timer = (TimerState *)data;
-    timer->timer_handle = NULL;
-    
-    if (timer->seconds_remaining > 0) {
-        timer->seconds_remaining--;
-        timer->timer_handle = app_timer_register(1000, timer_callback, timer);
-    } else {
-        // Vibrate when a stage completes - pattern depends on which timer
-        if (s_settings.vibration_enabled) {
-            if (timer == &s_timer1) {
-                // Timer 1: single pulse when finished
-                vibes_short_pulse();
-            } else {
-                // Timer 2: double pulse when finished
-                vibes_double_pulse();
-            }
+// Stopped timers sit at the start of their stage, so they pick up the new time
+static void reload_idle_timers() {
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        TimerState *timer = &s_timers[i];
+        if (!timer->running && !timer->paused) {
+            TimerConfig config = get_timer_config(timer->id, timer->mode);
+            set_timer_duration(timer, config.timing_array[timer->stage]);
         }
-        
-        // Move to next stage but don't start it automatically
-        timer->stage++;
-        
-        // Determine which timer this is (1 or 2)
-        int timer_number = (timer == &s_timer1) ? 1 : 2;
-        
-        // Get timer configuration to determine max stages and timing
-        TimerConfig config = get_timer_config(timer_number, timer->mode);
+    }
+}
 
-        TimerStage max_stage;
-        
-        if (timer->mode == MODE_FILM) {
-            max_stage = STAGE_WASH; // Film always has 4 stages ending at STAGE_WASH
-        } else if (timer->paper_type == PAPER_RC) {
-            max_stage = STAGE_WASH; // RC paper has 4 stages ending at STAGE_WASH
-        } else {
-            max_stage = STAGE_WASH2; // Fiber paper has 6 stages ending at STAGE_WASH2
-        }
-        
-        if (timer->stage > max_stage) {
-            timer->stage = STAGE_DEVELOP;
-            timer->running = false;
-        } else {
-            // Set the time for the next stage using the configuration
-            timer->seconds_remaining = config.timing_array[timer->stage];
-            timer->running = false;  // Don't start running automatically
-            
-            // Add a delayed reminder vibration
-            if (s_settings.vibration_enabled) {
-                app_timer_register(2000, delayed_vibration_callback, timer);
-            }
-        }
+static void time_editor_disappear(Window *window) {
+    if (*s_time_editor.target == s_time_editor.value) {
+        return;
     }
-    
-    if ((timer == &s_timer1 && s_active_timer == 1) ||
-        (timer == &s_timer2 && s_active_timer == 2)) {
-        update_timer_text();
-        update_mode_text();
+    *s_time_editor.target = s_time_editor.value;
+    reload_idle_timers();
+    journal_write();  // Restore reads idle durations from the journal
+    mark_settings_dirty();
+}
+
+static void destroy_time_editor() {
+    if (s_time_editor.window) {
+        window_destroy(s_time_editor.window);
+        s_time_editor.window = NULL;
     }
-    
-    layer_mark_dirty(s_canvas_layer);
 }
 
-static void force_screen_refresh() {
-    // Force a complete layer refresh to address screen tearing
-    layer_mark_dirty(window_get_root_layer(s_main_window));
-    
-    // Optionally provide haptic feedback to confirm the action
-    if (s_settings.vibration_enabled) {
-        vibes_short_pulse();
+static void open_time_editor(const MenuRow *row) {
+    if (!s_time_editor.window) {
+        s_time_editor.window = window_create();
+        window_set_click_config_provider(s_time_editor.window, time_editor_click_config_provider);
+        window_set_window_handlers(s_time_editor.window, (WindowHandlers) {
+            .load = time_editor_load,
+            .disappear = time_editor_disappear,
+            .unload = time_editor_unload,
+        });
     }
+    s_time_editor.label = row->label;
+    s_time_editor.target = row->value;
+    s_time_editor.value = *s_time_editor.target;
+    s_time_editor.editing_seconds = false;
+    window_stack_push(s_time_editor.window, true);
 }
 
 // Menu callbacks
 static uint16_t menu_get_num_sections_callback(MenuLayer *menu_layer, void *data) {
-    return 5;
+    return ARRAY_LENGTH(s_menu_sections);
 }
 
 static uint16_t menu_get_num_rows_callback(MenuLayer *menu_layer, uint16_t section_index, void *data) {
-    switch (section_index) {
-        case 0: return 2;  // Basic Settings
-        case 1: return 3;  // Color Settings
-        case 2: return 4;  // Film times
-        case 3: return 4;  // RC Print times
-        case 4: return 5;  // Fiber Print times
-        default: return 0;
-    }
+    return s_menu_sections[section_index].row_count;
 }
 
 static int16_t menu_get_header_height_callback(MenuLayer *menu_layer, uint16_t section_index, void *data) {
@@ -346,126 +1958,13 @@ static int16_t menu_get_header_height_callback(MenuLayer *menu_layer, uint16_t s
 }
 
 static void menu_draw_header_callback(GContext* ctx, const Layer *cell_layer, uint16_t section_index, void *data) {
-    switch (section_index) {
-        case 0:
-            menu_cell_basic_header_draw(ctx, cell_layer, "Basic Settings");
-            break;
-        case 1:
-            menu_cell_basic_header_draw(ctx, cell_layer, "Display Settings");
-            break;
-        case 2:
-            menu_cell_basic_header_draw(ctx, cell_layer, "Film Times");
-            break;
-        case 3:
-            menu_cell_basic_header_draw(ctx, cell_layer, "RC Print Times");
-            break;
-        case 4:
-            menu_cell_basic_header_draw(ctx, cell_layer, "Fiber Print Times");
-            break;
-    }
+    menu_cell_basic_header_draw(ctx, cell_layer, s_menu_sections[section_index].title);
 }
 
 static void menu_draw_row_callback(GContext* ctx, const Layer *cell_layer, MenuIndex *cell_index, void *data) {
     char buffer[32];
-    
-    switch (cell_index->section) {
-        case 0:
-            switch (cell_index->row) {
-                case 0:
-                    snprintf(buffer, sizeof(buffer), "Vibration: %s", 
-                             s_settings.vibration_enabled ? "On" : "Off");
-                    break;
-                case 1:
-                    snprintf(buffer, sizeof(buffer), "Backlight: %s", 
-                             s_settings.backlight_enabled ? "On" : "Off");
-                    break;
-            }
-            break;
-        case 1:
-            switch (cell_index->row) {
-                case 0:
-                    snprintf(buffer, sizeof(buffer), "Invert Timer 1: %s",
-                             s_settings.invert_timer1_colors ? "On" : "Off");
-                    break;
-                case 1:
-                    snprintf(buffer, sizeof(buffer), "Invert Timer 2: %s",
-                             s_settings.invert_timer2_colors ? "On" : "Off");
-                    break;
-                case 2:
-                    snprintf(buffer, sizeof(buffer), "Invert Menu: %s",
-                             s_settings.invert_menu_colors ? "On" : "Off");
-                    break;
-            }
-            break;
-        case 2:
-            switch (cell_index->row) {
-                case 0:
-                    snprintf(buffer, sizeof(buffer), "Develop: %d:%02d", 
-                             film_times[0]/60, film_times[0]%60);
-                    break;
-                case 1:
-                    snprintf(buffer, sizeof(buffer), "Stop: %d:%02d", 
-                             film_times[1]/60, film_times[1]%60);
-                    break;
-                case 2:
-                    snprintf(buffer, sizeof(buffer), "Fix: %d:%02d", 
-                             film_times[2]/60, film_times[2]%60);
-                    break;
-                case 3:
-                    snprintf(buffer, sizeof(buffer), "Wash: %d:%02d", 
-                             film_times[3]/60, film_times[3]%60);
-                    break;
-            }
-            break;
-        case 3:
-            switch (cell_index->row) {
-                case 0:
-                    snprintf(buffer, sizeof(buffer), "Develop: %d:%02d", 
-                             rc_print_times[0]/60, rc_print_times[0]%60);
-                    break;
-                case 1:
-                    snprintf(buffer, sizeof(buffer), "Stop: %d:%02d", 
-                             rc_print_times[1]/60, rc_print_times[1]%60);
-                    break;
-                case 2:
-                    snprintf(buffer, sizeof(buffer), "Fix: %d:%02d", 
-                             rc_print_times[2]/60, rc_print_times[2]%60);
-                    break;
-                case 3:
-                    snprintf(buffer, sizeof(buffer), "Wash: %d:%02d", 
-                             rc_print_times[3]/60, rc_print_times[3]%60);
-                    break;
-            }
-            break;
-        case 4:
-            switch (cell_index->row) {
-                case 0:
-                    snprintf(buffer, sizeof(buffer), "Develop: %d:%02d",
-                             fiber_print_times[0]/60, fiber_print_times[0]%60);
-                    break;
-                case 1:
-                    snprintf(buffer, sizeof(buffer), "Stop: %d:%02d",
-                             fiber_print_times[1]/60, fiber_print_times[1]%60);
-                    break;
-                case 2:
-                    snprintf(buffer, sizeof(buffer), "Fix: %d:%02d",
-                             fiber_print_times[2]/60, fiber_print_times[2]%60);
-                    break;
-                case 3:
-                    snprintf(buffer, sizeof(buffer), "Wash: %d:%02d",
-                             fiber_print_times[3]/60, fiber_print_times[3]%60);
-                    break;
-                case 4:
-                    snprintf(buffer, sizeof(buffer), "HC: %d:%02d",
-                             fiber_print_times[4]/60, fiber_print_times[4]%60);
-                    break;
-                case 5:
-                    snprintf(buffer, sizeof(buffer), "Wash2: %d:%02d",
-                             fiber_print_times[5]/60, fiber_print_times[5]%60);
-                    break;
-            }
-            break;
-    }
+    const MenuRow *row = get_menu_row(cell_index);
+    row->format(row, buffer, sizeof(buffer));
     
     // Apply menu color inversion if enabled
     if (s_settings.invert_menu_colors) {
@@ -478,126 +1977,67 @@ static void menu_draw_row_callback(GContext* ctx, const Layer *cell_layer, MenuI
 }
 
 static void menu_select_callback(MenuLayer *menu_layer, MenuIndex *cell_index, void *data) {
-    // First item in Basic Settings section (row 0) triggers force screen refresh
-    if (cell_index->section == 0 && cell_index->row == 0) {
-        force_screen_refresh();
-        return;
-    }
+    const MenuRow *row = get_menu_row(cell_index);
     
-    switch (cell_index->section) {
-        case 0:
-            switch (cell_index->row) {
-                case 0:
-                    // Force screen refresh handled at the beginning of this function
-                    break;
-                case 1:
-                    s_settings.backlight_enabled = !s_settings.backlight_enabled;
-                    light_enable(s_settings.backlight_enabled);
-                    break;
-            }
-            break;
-        case 1:
-            switch (cell_index->row) {
-                case 0:
-                    s_settings.invert_timer1_colors = !s_settings.invert_timer1_colors;
-                    break;
-                case 1:
-                    s_settings.invert_timer2_colors = !s_settings.invert_timer2_colors;
-                    break;
-                case 2:
-                    s_settings.invert_menu_colors = !s_settings.invert_menu_colors;
-                    break;
-            }
-            break;
-        case 2: {
-            // Time adjustment window for film times
-            NumberWindow *number_window = number_window_create(
-                "Adjust Time (seconds)",
-                (NumberWindowCallbacks) {
-                    .decremented = NULL,
-                    .incremented = NULL,
-                    .selected = NULL,
-                },
-                NULL
-            );
-            number_window_set_value(number_window, film_times[cell_index->row]);
-            window_stack_push(number_window_get_window(number_window), true);
+    switch (row->editor) {
+        case MENU_EDIT_TOGGLE: {
+            bool *value = row->value;
+            *value = !*value;
             break;
         }
-        case 3: {
-            // Time adjustment window for RC print times
-            NumberWindow *number_window = number_window_create(
-                "Adjust Time (seconds)",
-                (NumberWindowCallbacks) {
-                    .decremented = NULL,
-                    .incremented = NULL,
-                    .selected = NULL,
-                },
-                NULL
-            );
-            number_window_set_value(number_window, rc_print_times[cell_index->row]);
-            window_stack_push(number_window_get_window(number_window), true);
-            break;
-        }
-        case 4: {
-            // Time adjustment window for Fiber print times
-            NumberWindow *number_window = number_window_create(
-                "Adjust Time (seconds)",
-                (NumberWindowCallbacks) {
-                    .decremented = NULL,
-                    .incremented = NULL,
-                    .selected = NULL,
-                },
-                NULL
-            );
-            
-            number_window_set_value(number_window, fiber_print_times[cell_index->row]);
-            window_stack_push(number_window_get_window(number_window), true);
+        case MENU_EDIT_CYCLE: {
+            uint8_t *value = row->value;
+            *value = (*value >= row->max) ? row->min : *value + row->step;
             break;
         }
+        case MENU_EDIT_TIME:
+            // The row is redrawn when the menu comes back into view
+            open_time_editor(row);
+            return;
     }
+    if (row->changed) {
+        row->changed();
+    }
+    mark_settings_dirty();
     
-    save_settings();
+    // MenuLayer has no per-row reload; the selected row is the only
+    // content that changed, so redraw the menu without reloading its data
     layer_mark_dirty(menu_layer_get_layer(menu_layer));
-    layer_mark_dirty(s_canvas_layer);
 }
 
 static void reset_timer(TimerState *timer) {
-    if (timer->timer_handle) {
-        app_timer_cancel(timer->timer_handle);
-        timer->timer_handle = NULL;
-    }
     timer->running = false;
     timer->paused = false;
+    cancel_cues(timer);
     timer->stage = STAGE_DEVELOP;
     
-    // Determine which timer this is (1 or 2)
-    int timer_number = (timer == &s_timer1) ? 1 : 2;
-    
     // Get timer configuration
-    TimerConfig config = get_timer_config(timer_number, timer->mode);
+    TimerConfig config = get_timer_config(timer->id, timer->mode);
     
     // Update timer properties based on configuration
     timer->paper_type = config.paper_type;
     timer->max_stages = config.stage_count;
     
     // Set initial timing for develop stage
-    timer->seconds_remaining = config.timing_array[STAGE_DEVELOP];
+    set_timer_duration(timer, config.timing_array[STAGE_DEVELOP]);
+    scheduler_update(timer, now_ms());
 }
 
 static void pause_timer(TimerState *timer) {
-    if (timer->timer_handle) {
-        app_timer_cancel(timer->timer_handle);
-        timer->timer_handle = NULL;
-    }
+    int64_t now = now_ms();
+    
+    // Bank the time left so resume picks up mid-second where we stopped
+    timer->remaining_ms = get_remaining_ms(timer, now);
+    timer->seconds_remaining = (timer->remaining_ms + 999) / 1000;
     timer->paused = true;
     timer->running = false;
+    cancel_cues(timer);
+    scheduler_update(timer, now);
+    journal_write();
 }
 
 static void resume_timer(TimerState *timer) {
-    timer->paused = false;
-    timer->running = true;
-    timer->timer_handle = app_timer_register(1000, timer_callback, timer);
+    start_timer(timer);
 }
 
 // Helper function to get max stage for current timer
@@ -611,42 +2051,78 @@ static TimerStage get_max_stage(TimerState *timer) {
     }
 }
 
+// Change how many timers are in use, stopping any that drop out of the pool
+static void set_timer_count(int count) {
+    bool dropped_active = false;
+    
+    s_settings.timer_count = count;
+    for (int i = count; i < MAX_TIMERS; i++) {
+        dropped_active |= s_timers[i].running || s_timers[i].paused;
+        reset_timer(&s_timers[i]);
+    }
+    if (s_active_timer > count) {
+        s_active_timer = 1;
+        scheduler_update(get_active_timer(), now_ms());
+        s_dirty = DIRTY_ALL;
+    }
+    if (dropped_active) {
+        journal_write();
+    }
+}
+
+// A button press switches the displayed countdowns to seconds for a while
+static void note_interaction() {
+    int64_t now = now_ms();
+    s_last_interaction_ms = now;
+    update_displayed_timers(now);
+    s_dirty |= DIRTY_TIME;
+}
+
+static void open_menu_window();
+
 // Click handlers
 static void select_click_handler(ClickRecognizerRef recognizer, void *context) {
-    window_stack_push(s_menu_window, true);
+    open_menu_window();
 }
 
 // Up button single - reset current timer
 static void up_click_handler(ClickRecognizerRef recognizer, void *context) {
+    note_interaction();
     TimerState *timer = get_active_timer();
     reset_timer(timer);
-    update_timer_text();
-    update_mode_text();
-    layer_mark_dirty(s_canvas_layer);
+    journal_write();
+    s_dirty |= DIRTY_TIME | DIRTY_MODE | DIRTY_NAME;
+    render_commit();
 }
 
 // Up button double - switch between timer 1 and timer 2
 static void up_double_click_handler(ClickRecognizerRef recognizer, void *context) {
-    s_active_timer = (s_active_timer == 1) ? 2 : 1;
-    update_timer_text();
-    update_mode_text();
-    update_timer_name_text();
-    force_screen_refresh();
-    layer_mark_dirty(s_canvas_layer);
+    TimerState *previous = get_active_timer();
+    int previous_partner = get_split_partner(s_active_timer);
+    s_active_timer = s_active_timer % s_settings.timer_count + 1;
+    
+    // Only the displayed timers need per-second events
+    int64_t now = now_ms();
+    s_last_interaction_ms = now;
+    scheduler_update(previous, now);
+    if (previous_partner != 0) {
+        scheduler_update(&s_timers[previous_partner - 1], now);
+    }
+    update_displayed_timers(now);
+    s_dirty = DIRTY_ALL;
+    render_commit();
 }
 
 // Up button long - scroll forward through stages in current timer
 static void up_long_click_handler(ClickRecognizerRef recognizer, void *context) {
+    note_interaction();
     TimerState *timer = get_active_timer();
     TimerStage max_stage = get_max_stage(timer);
     
     // Stop the timer if running
-    if (timer->timer_handle) {
-        app_timer_cancel(timer->timer_handle);
-        timer->timer_handle = NULL;
-    }
     timer->running = false;
     timer->paused = false;
+    cancel_cues(timer);
     
     // Move to next stage
     if (timer->stage < max_stage) {
@@ -657,63 +2133,61 @@ static void up_long_click_handler(ClickRecognizerRef recognizer, void *context)
     }
     
     // Update timer seconds based on new stage
-    int timer_number = (timer == &s_timer1) ? 1 : 2;
-    TimerConfig config = get_timer_config(timer_number, timer->mode);
-    timer->seconds_remaining = config.timing_array[timer->stage];
+    TimerConfig config = get_timer_config(timer->id, timer->mode);
+    set_timer_duration(timer, config.timing_array[timer->stage]);
+    scheduler_update(timer, now_ms());
+    journal_write();
     
-    update_timer_text();
-    update_mode_text();
-    layer_mark_dirty(s_canvas_layer);
+    s_dirty |= DIRTY_TIME | DIRTY_MODE;
+    render_commit();
 }
 
 // Down button - control current timer
 static void down_click_handler(ClickRecognizerRef recognizer, void *context) {
+    note_interaction();
     TimerState *timer = get_active_timer();
     
     if (!timer->running && !timer->paused) {
-        timer->running = true;
-        timer->timer_handle = app_timer_register(1000, timer_callback, timer);
+        start_timer(timer);
     } else if (timer->running) {
         pause_timer(timer);
     } else if (timer->paused) {
         resume_timer(timer);
     }
     
-    update_mode_text();
-    layer_mark_dirty(s_canvas_layer);
+    s_dirty |= DIRTY_MODE | DIRTY_NAME;
+    render_commit();
 }
 
 // Down button double - switch between film and print modes
 static void down_double_click_handler(ClickRecognizerRef recognizer, void *context) {
+    note_interaction();
     TimerState *timer = get_active_timer();
     timer->mode = (timer->mode == MODE_FILM) ? MODE_PRINT : MODE_FILM;
     
     // When switching to print mode, restore the appropriate paper type for each timer
     if (timer->mode == MODE_PRINT) {
-        int timer_number = (timer == &s_timer1) ? 1 : 2;
-        TimerConfig config = get_timer_config(timer_number, MODE_PRINT);
+        TimerConfig config = get_timer_config(timer->id, MODE_PRINT);
         timer->paper_type = config.paper_type;
         timer->max_stages = config.stage_count;
     }
     
     reset_timer(timer);
-    update_timer_text();
-    update_mode_text();
-    layer_mark_dirty(s_canvas_layer);
+    journal_write();
+    s_dirty |= DIRTY_TIME | DIRTY_MODE | DIRTY_NAME;
+    render_commit();
 }
 
 // Down button long - scroll backward through stages in current timer
 static void down_long_click_handler(ClickRecognizerRef recognizer, void *context) {
+    note_interaction();
     TimerState *timer = get_active_timer();
     TimerStage max_stage = get_max_stage(timer);
     
     // Stop the timer if running
-    if (timer->timer_handle) {
-        app_timer_cancel(timer->timer_handle);
-        timer->timer_handle = NULL;
-    }
     timer->running = false;
     timer->paused = false;
+    cancel_cues(timer);
     
     // Move to previous stage
     if (timer->stage > STAGE_DEVELOP) {
@@ -724,13 +2198,13 @@ static void down_long_click_handler(ClickRecognizerRef recognizer, void *context
     }
     
     // Update timer seconds based on new stage
-    int timer_number = (timer == &s_timer1) ? 1 : 2;
-    TimerConfig config = get_timer_config(timer_number, timer->mode);
-    timer->seconds_remaining = config.timing_array[timer->stage];
+    TimerConfig config = get_timer_config(timer->id, timer->mode);
+    set_timer_duration(timer, config.timing_array[timer->stage]);
+    scheduler_update(timer, now_ms());
+    journal_write();
     
-    update_timer_text();
-    update_mode_text();
-    layer_mark_dirty(s_canvas_layer);
+    s_dirty |= DIRTY_TIME | DIRTY_MODE;
+    render_commit();
 }
 
 static void click_config_provider(void *context) {
@@ -748,9 +2222,6 @@ static void click_config_provider(void *context) {
 
 static void main_window_unload(Window *window) {
     layer_destroy(s_canvas_layer);
-    text_layer_destroy(s_timer_layer);
-    text_layer_destroy(s_mode_layer);
-    text_layer_destroy(s_timer_name_layer);
 }
 
 static void menu_window_load(Window *window) {
@@ -769,22 +2240,37 @@ static void menu_window_load(Window *window) {
     });
     
     // handle menu color inversion
-    if (s_settings.invert_menu_colors) {
-        window_set_background_color(s_menu_window, GColorBlack);
-        menu_layer_set_normal_colors(s_menu_layer, GColorBlack, GColorWhite);
-        menu_layer_set_highlight_colors(s_menu_layer, GColorWhite, GColorBlack);
-    } else {
-        window_set_background_color(s_menu_window, GColorWhite);
-        menu_layer_set_normal_colors(s_menu_layer, GColorWhite, GColorBlack);
-        menu_layer_set_highlight_colors(s_menu_layer, GColorBlack, GColorWhite);
-    }
+    apply_menu_colors();
     
     menu_layer_set_click_config_onto_window(s_menu_layer, window);
     layer_add_child(window_layer, menu_layer_get_layer(s_menu_layer));
 }
 
+// Most sessions never open the menu, so its window and the time editor
+// are created on first use and freed again as soon as the menu is popped
 static void menu_window_unload(Window *window) {
     menu_layer_destroy(s_menu_layer);
+    s_menu_layer = NULL;
+    destroy_time_editor();
+    if (s_menu_timer_count != s_settings.timer_count) {
+        set_timer_count(s_menu_timer_count);
+        mark_settings_dirty();
+    }
+    flush_settings();
+    window_destroy(window);
+    s_menu_window = NULL;
+}
+
+static void open_menu_window() {
+    if (!s_menu_window) {
+        s_menu_window = window_create();
+        window_set_window_handlers(s_menu_window, (WindowHandlers) {
+            .load = menu_window_load,
+            .unload = menu_window_unload,
+        });
+    }
+    s_menu_timer_count = s_settings.timer_count;
+    window_stack_push(s_menu_window, true);
 }
 
 // Helper function to get stage display index for proper visual representation
@@ -812,13 +2298,12 @@ static int get_stage_display_index(TimerStage stage, PaperType paper_type) {
     }
 }
 
-// Helper function to draw stage indicators
-static void draw_stage_indicators(GContext *ctx, GRect bounds, TimerStage stage, int max_stages, PaperType paper_type) {
-    // Calculate indicator width accounting for spacing between indicators
-    const int spacing = 2;
-    const int total_spacing = (max_stages - 1) * spacing;
-    const int available_width = bounds.size.w - total_spacing;
-    const int indicator_width = available_width / max_stages;
+// Helper function to draw stage indicators. Finished stages are filled, the
+// current stage is outlined and filled up to progress, later stages are a
+// thin line.
+static void draw_stage_indicators(GContext *ctx, GRect bounds, TimerStage stage, int max_stages,
+                                  PaperType paper_type, int progress) {
+    const int indicator_width = get_indicator_width(bounds, max_stages);
     const int indicator_height = 3;
     
     // Get the current stage display index
@@ -826,78 +2311,195 @@ static void draw_stage_indicators(GContext *ctx, GRect bounds, TimerStage stage,
     
     for (int i = 0; i < max_stages; i++) {
         GRect indicator_bounds = GRect(
-            bounds.origin.x + (i * (indicator_width + spacing)),
+            bounds.origin.x + (i * (indicator_width + INDICATOR_SPACING)),
             bounds.origin.y,
             indicator_width,
             indicator_height
         );
         
-        // Fill indicators up to and including the current stage
-        if (i <= current_stage_index) {
+        if (i < current_stage_index) {
             graphics_fill_rect(ctx, indicator_bounds, 0, GCornerNone);
-        } else {
+        } else if (i == current_stage_index) {
             graphics_draw_rect(ctx, indicator_bounds);
+            indicator_bounds.size.w = progress;
+            graphics_fill_rect(ctx, indicator_bounds, 0, GCornerNone);
+        } else {
+            graphics_fill_rect(ctx, GRect(indicator_bounds.origin.x, indicator_bounds.origin.y + 1,
+                                          indicator_width, 1), 0, GCornerNone);
         }
     }
 }
 
-// Helper function to get display theme for a timer
-typedef struct {
-    bool is_light_background;
-    GColor text_color;
-    GColor background_color;
-} DisplayTheme;
-
-static DisplayTheme get_display_theme(int timer_number) {
-    bool should_invert = (timer_number == 1) ? 
-        s_settings.invert_timer1_colors : s_settings.invert_timer2_colors;
+#if defined(PBL_ROUND)
+// The same indicators as arcs around the bezel, from the cached segments
+static void draw_stage_ring(GContext *ctx, GRect bounds, TimerStage stage, int max_stages,
+                            PaperType paper_type, int progress) {
+    build_ring_segments(max_stages);
+    int32_t span = DEG_TO_TRIGANGLE(s_ring_segment_deg);
+    int current_stage_index = get_stage_display_index(stage, paper_type);
     
-    // Timer 1 defaults to light mode, Timer 2 defaults to dark mode
-    bool default_light = (timer_number == 1);
+    for (int i = 0; i < max_stages; i++) {
+        int32_t start = s_ring_starts[i];
+        if (i < current_stage_index) {
+            graphics_fill_radial(ctx, bounds, GOvalScaleModeFitCircle, RING_THICKNESS, start, start + span);
+            continue;
+        }
+        graphics_fill_radial(ctx, bounds, GOvalScaleModeFitCircle, RING_TRACK_THICKNESS, start, start + span);
+        if (i == current_stage_index && progress > 0) {
+            graphics_fill_radial(ctx, bounds, GOvalScaleModeFitCircle, RING_THICKNESS,
+                                 start, start + DEG_TO_TRIGANGLE(progress));
+        }
+    }
+}
+#endif
+
+// Both timers of the pair, top and bottom, in the same pass as everything else
+static void draw_split_view(GContext *ctx) {
+    for (int i = 0; i < 2; i++) {
+        SplitPane *pane = &s_split_panes[i];
+        const PaneLayout *layout = &s_layout.panes[i];
+        const DisplayTheme *theme = &s_timer_themes[pane->timer->id - 1];
+        
+        graphics_context_set_fill_color(ctx, theme->background_color);
+        graphics_fill_rect(ctx, layout->bounds, 0, GCornerNone);
+        graphics_context_set_fill_color(ctx, theme->text_color);
+        graphics_context_set_stroke_color(ctx, theme->text_color);
+        graphics_context_set_text_color(ctx, theme->text_color);
+        
+        graphics_draw_text(ctx, pane->name_text, s_line_font, layout->name,
+                           GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
+        graphics_draw_text(ctx, pane->time_text, s_pane_font, layout->time,
+                           GTextOverflowModeFill, GTextAlignmentCenter, NULL);
+        graphics_draw_text(ctx, pane->mode_text, s_line_font, layout->mode,
+                           GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
+        if (pane->timer->id == s_active_timer) {
+            graphics_fill_rect(ctx, layout->marker, 0, GCornerNone);
+        }
+        draw_stage_indicators(ctx, layout->indicators, pane->timer->stage,
+                              pane->timer->max_stages, pane->timer->paper_type, pane->progress);
+    }
+}
+
+// Bring the text the canvas draws up to date with everything that changed
+// during one event and request a single frame for all of it, so the
+// digits, text lines and stage indicators always appear together. Every
+// handler ends with one commit. While the main window is covered the dirty
+// bits just accumulate until it is shown again.
+static void render_commit() {
+    if (!s_dirty || !is_main_window_visible()) {
+        return;
+    }
     
-    // Apply inversion settings to override defaults
-    if (should_invert) {
-        default_light = !default_light;
+    // Stage indicators are read straight from the model; a theme change,
+    // including a switch to another timer, only swaps the theme pointer
+    bool changed = (s_dirty & (DIRTY_MODE | DIRTY_THEME)) != 0;
+    if (s_dirty & DIRTY_THEME) {
+        s_theme = &s_timer_themes[s_active_timer - 1];
+    }
+    if (is_split_view()) {
+        // Both panes come from the per-timer caches, so rebuild them together
+        changed |= (s_dirty & DIRTY_NAME) != 0;
+        changed |= prepare_split_panes();
+    } else {
+        if (s_dirty & DIRTY_TIME) {
+            changed |= update_timer_text();
+        }
+        if (s_dirty & DIRTY_MODE) {
+            changed |= update_mode_text();
+        }
+        if (s_dirty & DIRTY_NAME) {
+            changed |= update_timer_name_text();
+        }
+        if (s_dirty & (DIRTY_TIME | DIRTY_MODE)) {
+            changed |= update_progress();
+        }
     }
+    s_dirty = 0;
     
-    return (DisplayTheme){
-        .is_light_background = default_light,
-        .text_color = default_light ? GColorBlack : GColorWhite,
-        .background_color = default_light ? GColorWhite : GColorBlack
-    };
+    if (changed) {
+        layer_mark_dirty(s_canvas_layer);
+        s_frame_count++;
+    }
 }
 
-// Update the canvas drawing procedure
+// The whole screen in one pass: text prepared by render_commit() is drawn
+// into the rects laid out by main_window_load()
 static void canvas_update_proc(Layer *layer, GContext *ctx) {
+    int64_t start = now_ms();
     GRect bounds = layer_get_bounds(layer);
     TimerState *timer = get_active_timer();
     
-    // Get the appropriate display theme for the active timer
-    DisplayTheme theme = get_display_theme(s_active_timer);
+    s_redraw_count++;
+    if (s_redraw_count == 1) {
+        s_first_frame_ms = (uint32_t)(start - s_launch_ms);
+    }
     
-    // Apply background color to window
-    window_set_background_color(s_main_window, theme.background_color);
+    if (is_split_view()) {
+        draw_split_view(ctx);
+        s_render_ms += (uint32_t)(now_ms() - start);
+        return;
+    }
     
-    // Set graphics context colors for drawing stage indicators
-    graphics_context_set_fill_color(ctx, theme.text_color);
-    graphics_context_set_stroke_color(ctx, theme.text_color);
+    graphics_context_set_fill_color(ctx, s_theme->background_color);
+    graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+    graphics_context_set_fill_color(ctx, s_theme->text_color);
+    graphics_context_set_stroke_color(ctx, s_theme->text_color);
+    graphics_context_set_text_color(ctx, s_theme->text_color);
     
-    // Apply colors to all text layers
-    text_layer_set_text_color(s_timer_layer, theme.text_color);
-    text_layer_set_background_color(s_timer_layer, GColorClear);
-    text_layer_set_text_color(s_mode_layer, theme.text_color);
-    text_layer_set_background_color(s_mode_layer, GColorClear);
-    text_layer_set_text_color(s_timer_name_layer, theme.text_color);
-    text_layer_set_background_color(s_timer_name_layer, GColorClear);
+    if (s_shown_name_text) {
+        graphics_draw_text(ctx, s_shown_name_text, s_line_font, s_layout.name,
+                           GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
+    }
+    if (s_shown_mode_text) {
+        graphics_draw_text(ctx, s_shown_mode_text, s_line_font, s_layout.mode,
+                           GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
+    }
+    draw_digit_cells(ctx);
     
-    // Update text layers
-    update_timer_text();
-    update_mode_text();
-    update_timer_name_text();
+    // Stage indicators: a ring around the bezel on round screens, a strip
+    // along the bottom elsewhere
+#if defined(PBL_ROUND)
+    draw_stage_ring(ctx, s_layout.indicators, timer->stage, timer->max_stages,
+                    timer->paper_type, s_shown_progress);
+#else
+    draw_stage_indicators(ctx, s_layout.indicators, timer->stage, timer->max_stages,
+                          timer->paper_type, s_shown_progress);
+#endif
+    s_render_ms += (uint32_t)(now_ms() - start);
+}
+
+// The displayed timers drop to deadline-only ticks while covered; coming
+// back, the whole screen is rebuilt from the timer state
+static void set_main_window_visibility(bool shown, bool in_focus) {
+    bool was_visible = is_main_window_visible();
+    s_main_window_shown = shown;
+    s_app_in_focus = in_focus;
+    if (is_main_window_visible() == was_visible) {
+        return;
+    }
     
-    // Draw stage indicators at the bottom of the screen
-    GRect indicator_bounds = GRect(10, bounds.size.h - 20, bounds.size.w - 20, 3);
-    draw_stage_indicators(ctx, indicator_bounds, timer->stage, timer->max_stages, timer->paper_type);
+    update_displayed_timers(now_ms());
+    if (is_main_window_visible()) {
+        s_dirty = DIRTY_ALL;
+        render_commit();
+    }
+}
+
+static void main_window_appear(Window *window) {
+    set_main_window_visibility(true, s_app_in_focus);
+}
+
+static void main_window_disappear(Window *window) {
+    set_main_window_visibility(false, s_app_in_focus);
+}
+
+static void app_focus_handler(bool in_focus) {
+    set_main_window_visibility(s_main_window_shown, in_focus);
+    if (!in_focus) {
+        flush_settings();
+    } else {
+        resolve_worker_confirmation();
+    }
 }
 
 // Window load/unload
@@ -910,81 +2512,93 @@ static void main_window_load(Window *window) {
     layer_set_update_proc(s_canvas_layer, canvas_update_proc);
     layer_add_child(window_layer, s_canvas_layer);
     
-    // Constants for layout
-    const int mode_layer_height = 20;
-    const int timer_name_height = 20;
-    const int timer_vertical_padding = 10;
-    
-    // Create timer name layer (at top)
-    s_timer_name_layer = text_layer_create(GRect(0, timer_vertical_padding, bounds.size.w, timer_name_height));
-    text_layer_set_font(s_timer_name_layer, fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD));
-    text_layer_set_text_alignment(s_timer_name_layer, GTextAlignmentCenter);
-    layer_add_child(s_canvas_layer, text_layer_get_layer(s_timer_name_layer));
-    
-    // Create mode layer (below timer name)
-    s_mode_layer = text_layer_create(GRect(0, timer_name_height + timer_vertical_padding*2, 
-                                          bounds.size.w, mode_layer_height));
-    text_layer_set_font(s_mode_layer, fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD));
-    text_layer_set_text_alignment(s_mode_layer, GTextAlignmentCenter);
-    layer_add_child(s_canvas_layer, text_layer_get_layer(s_mode_layer));
-    
-    // Create main timer layer (centered)
-    const int timer_top_y = timer_name_height + mode_layer_height + timer_vertical_padding*3;
-    const int timer_height = bounds.size.h - timer_top_y - timer_vertical_padding*3;
-    
-    s_timer_layer = text_layer_create(GRect(0, timer_top_y, bounds.size.w, timer_height));
-    text_layer_set_font(s_timer_layer, fonts_get_system_font(FONT_KEY_BITHAM_42_BOLD));
-    text_layer_set_text_alignment(s_timer_layer, GTextAlignmentCenter);
-    layer_add_child(s_canvas_layer, text_layer_get_layer(s_timer_layer));
+    // Fonts are looked up once; the geometry comes from s_layout
+    s_line_font = fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD);
+    s_digit_font = fonts_get_system_font(FONT_KEY_BITHAM_42_BOLD);
+    s_pane_font = fonts_get_system_font(FONT_KEY_GOTHIC_28_BOLD);
+    measure_digit_glyphs();
+    s_digit_text[0] = '\0';
     
     // Initialize timers with proper paper types
-    // Timer 1 defaults to RC paper, Timer 2 defaults to Fiber paper
-    s_timer1.mode = MODE_PRINT;
-    s_timer1.paper_type = PAPER_RC;
-    s_timer1.max_stages = 4;
-    
-    s_timer2.mode = MODE_PRINT;
-    s_timer2.paper_type = PAPER_FIBER;
-    s_timer2.max_stages = 6;
+    // Odd timers default to RC paper, even timers default to Fiber paper
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        TimerState *timer = &s_timers[i];
+        timer->id = i + 1;
+        timer->mode = MODE_PRINT;
+        s_heap_pos[i] = -1;
+        reset_timer(timer);
+    }
+    invalidate_text_cache();
     
-    reset_timer(&s_timer1);
-    reset_timer(&s_timer2);
+    s_dirty = DIRTY_ALL;
+    render_commit();
 }
 
 static void init(void) {
+    s_launch_ms = now_ms();
+    
     // Load saved settings
     load_settings();
+    s_worker_declined = persist_read_bool(WORKER_DECLINED_KEY);
     
     // Create main window
     s_main_window = window_create();
     window_set_click_config_provider(s_main_window, click_config_provider);
     window_set_window_handlers(s_main_window, (WindowHandlers) {
         .load = main_window_load,
+        .appear = main_window_appear,
+        .disappear = main_window_disappear,
         .unload = main_window_unload,
     });
     
-    // Create menu window
-    s_menu_window = window_create();
-    window_set_window_handlers(s_menu_window, (WindowHandlers) {
-        .load = menu_window_load,
-        .unload = menu_window_unload,
-    });
-    
     // Push main window
     window_stack_push(s_main_window, true);
     
+    // Pick up timers left running by a previous session. The journal fills
+    // the first frame; a running worker's live records then replace it.
+    app_worker_message_subscribe(worker_message_handler);
+    bool worker_running = app_worker_is_running();
+    restore_timer_state(!worker_running);
+    if (worker_running) {
+        attach_to_worker();
+    }
+    
+    app_focus_service_subscribe(app_focus_handler);
+    
     if (s_settings.backlight_enabled) {
         light_enable(true);
     }
 }
 
 static void deinit(void) {
-    // Save settings before exit
-    save_settings();
+    // Close the menu first, top of the stack first: an open time editor
+    // writes its value back as it goes, and the menu applies a new timer
+    // count and frees itself on unload, before the timers are handed over
+    destroy_time_editor();
+    if (s_menu_window) {
+        window_stack_remove(s_menu_window, false);
+    }
+    
+    // Keep running stages alive in the worker, or with wakeups if it is
+    // unavailable; the journal covers a worker that gets stopped meanwhile
+    resolve_worker_confirmation();
+    if (!detach_from_worker()) {
+        schedule_stage_wakeups();
+    }
+    app_worker_message_unsubscribe();
+    app_focus_service_unsubscribe();
+    
+    APP_LOG(APP_LOG_LEVEL_DEBUG, "Shared tick wakeups this session: %lu, frames: %lu, render passes: %lu",
+            (unsigned long)s_tick_count, (unsigned long)s_frame_count, (unsigned long)s_redraw_count);
+    APP_LOG(APP_LOG_LEVEL_DEBUG, "Render time: %lu ms, digit glyphs changed: %lu",
+            (unsigned long)s_render_ms, (unsigned long)s_digit_glyph_changes);
+    APP_LOG(APP_LOG_LEVEL_DEBUG, "Launch to first frame: %lu ms", (unsigned long)s_first_frame_ms);
     
-    // Cleanup windows
     window_destroy(s_main_window);
-    window_destroy(s_menu_window);
+    
+    // Write any settings changes still pending
+    flush_settings();
+    APP_LOG(APP_LOG_LEVEL_DEBUG, "Settings writes this session: %lu", (unsigned long)s_settings_writes);
 }
 
 int main(void) {
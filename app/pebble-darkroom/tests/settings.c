@@ -1,6 +1,8 @@
 #include "settings.h"
 #include <stdio.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
 
 // Global settings and timer states (for testing purposes)
 static Settings s_settings = {
@@ -12,6 +14,7 @@ static Settings s_settings = {
 };
 
 static TimerState s_timer1 = {
+    .id = 1,
     .running = false,
     .paused = false,
     .mode = MODE_PRINT,
@@ -19,10 +22,14 @@ static TimerState s_timer1 = {
     .paper_type = PAPER_RC,
     .max_stages = 4,
     .seconds_remaining = 0,
+    .remaining_ms = 0,
+    .deadline_ms = 0,
+    .next_event_ms = 0,
     .timer_handle = NULL
 };
 
 static TimerState s_timer2 = {
+    .id = 2,
     .running = false,
     .paused = false,
     .mode = MODE_PRINT,
@@ -30,6 +37,9 @@ static TimerState s_timer2 = {
     .paper_type = PAPER_FIBER,
     .max_stages = 6,
     .seconds_remaining = 0,
+    .remaining_ms = 0,
+    .deadline_ms = 0,
+    .next_event_ms = 0,
     .timer_handle = NULL
 };
 
@@ -118,8 +128,8 @@ static TimerConfig get_timer_config(int timer_number, TimerMode mode) {
             .paper_name = "Film"
         };
     } else {
-        // Timer 1 = RC, Timer 2 = Fiber
-        if (timer_number == 1) {
+        // Odd timers = RC, even timers = Fiber
+        if (timer_number % 2 == 1) {
             return (TimerConfig){
                 .mode = MODE_PRINT,
                 .paper_type = PAPER_RC,
@@ -150,6 +160,659 @@ TimerStage get_max_stage(TimerState *timer) {
     }
 }
 
+// Mock wall clock for the deadline engine
+static int64_t s_mock_now_ms = 0;
+
+void set_mock_now_ms(int64_t now) {
+    s_mock_now_ms = now;
+}
+
+int64_t get_mock_now_ms(void) {
+    return s_mock_now_ms;
+}
+
+static int64_t now_ms(void) {
+    return s_mock_now_ms;
+}
+
+// Shared tick state (mirrors the app scheduler, with a pool of two timers)
+#define NUM_TIMERS 2
+static TimerState *const s_timers[NUM_TIMERS] = { &s_timer1, &s_timer2 };
+static int s_scheduler_active_timer = 1;
+static int64_t s_tick_armed_ms = 0;
+static uint32_t s_tick_delay_ms = 0;
+static uint32_t s_tick_count = 0;
+static int s_last_tick_serviced = 0;
+
+// Min-heap of running timers keyed by next_event_ms
+static uint8_t s_event_heap[NUM_TIMERS];
+static int8_t s_heap_pos[NUM_TIMERS] = { -1, -1 };
+static int s_heap_size = 0;
+
+static void scheduler_update(TimerState *timer, int64_t now);
+
+void set_scheduler_active_timer(int timer_number) {
+    TimerState *previous = s_timers[s_scheduler_active_timer - 1];
+    s_scheduler_active_timer = timer_number;
+    scheduler_update(previous, now_ms());
+    scheduler_update(s_timers[timer_number - 1], now_ms());
+}
+
+uint32_t get_armed_tick_delay(void) {
+    return s_tick_delay_ms;
+}
+
+uint32_t get_tick_count(void) {
+    return s_tick_count;
+}
+
+int get_heap_size(void) {
+    return s_heap_size;
+}
+
+int get_last_tick_serviced(void) {
+    return s_last_tick_serviced;
+}
+
+// Load a fresh stage duration into a stopped timer
+void set_timer_duration(TimerState *timer, int seconds) {
+    timer->seconds_remaining = seconds;
+    timer->remaining_ms = (int32_t)seconds * 1000;
+}
+
+// Milliseconds left in the current stage, derived from the deadline while running
+int32_t get_remaining_ms(TimerState *timer, int64_t now) {
+    if (!timer->running) {
+        return timer->remaining_ms;
+    }
+    int64_t remaining = timer->deadline_ms - now;
+    return remaining > 0 ? (int32_t)remaining : 0;
+}
+
+// Shift every running deadline when the wall clock moved back between two
+// ticks; a longer gap is late delivery and leaves the deadlines alone
+static void correct_clock_jump(int64_t now) {
+    int64_t drift = (now - s_tick_armed_ms) - s_tick_delay_ms;
+    if (drift >= -CLOCK_JUMP_TOLERANCE_MS) {
+        return;
+    }
+    for (int i = 0; i < s_heap_size; i++) {
+        TimerState *timer = s_timers[s_event_heap[i]];
+        timer->deadline_ms += drift;
+        timer->next_event_ms += drift;
+        timer->cue_ms += drift;
+    }
+    journal_write();
+}
+
+// Delay until the displayed second changes
+uint32_t get_tick_delay(int32_t remaining) {
+    uint32_t delay = remaining % 1000;
+    return delay == 0 ? 1000 : delay;
+}
+
+// Wall-clock time of the last button press
+static int64_t s_last_interaction_ms = 0;
+
+// Whole minutes until the final minute, or for a while after a button press
+bool use_minute_resolution(TimerState *timer, int64_t now) {
+    return timer->running &&
+           timer->seconds_remaining * 1000 > FINAL_MINUTE_MS &&
+           now - s_last_interaction_ms >= INTERACTION_WINDOW_MS;
+}
+
+void format_countdown(char *buffer, int size, TimerState *timer, int64_t now) {
+    if (use_minute_resolution(timer, now)) {
+        snprintf(buffer, size, "%dm", (timer->seconds_remaining + 59) / 60);
+    } else {
+        snprintf(buffer, size, "%02d:%02d",
+                 timer->seconds_remaining / 60, timer->seconds_remaining % 60);
+    }
+}
+
+// Delay until the displayed minute changes
+static uint32_t get_minute_tick_delay(int32_t remaining) {
+    uint32_t delay = remaining % FINAL_MINUTE_MS;
+    return delay == 0 ? FINAL_MINUTE_MS : delay;
+}
+
+// The displayed timer needs every boundary of its resolution, others only their deadline
+// Stage ends in seconds from the start of Develop, with a drain gap before
+// every later stage
+void build_process_schedule(TimerState *timer, uint8_t gap_s) {
+    TimerConfig config = get_timer_config(timer->id, timer->mode);
+    uint16_t end = 0;
+    
+    timer->gap_s = gap_s;
+    for (int i = 0; i < config.stage_count; i++) {
+        end += (i > 0 ? gap_s : 0) + config.timing_array[i];
+        timer->stage_end_s[i] = end;
+    }
+}
+
+static int32_t get_transition_offset_s(TimerState *timer) {
+    if (timer->draining) {
+        return timer->stage_end_s[timer->stage - 1] + timer->gap_s;
+    }
+    return timer->stage_end_s[timer->stage];
+}
+
+int32_t get_process_remaining_ms(TimerState *timer, int64_t now) {
+    int32_t after = timer->stage_end_s[timer->max_stages - 1] - get_transition_offset_s(timer);
+    return get_remaining_ms(timer, now) + after * 1000;
+}
+
+// Elapsed part of the current stage in steps (bar pixels or ring degrees)
+int get_stage_progress(TimerState *timer, int64_t now, int steps) {
+    TimerConfig config = get_timer_config(timer->id, timer->mode);
+    int32_t duration_ms = (int32_t)config.timing_array[timer->stage] * 1000;
+    int32_t elapsed_ms = duration_ms - get_remaining_ms(timer, now);
+    if (timer->draining || duration_ms <= 0 || elapsed_ms <= 0) {
+        return 0;
+    }
+    if (elapsed_ms >= duration_ms) {
+        return steps;
+    }
+    return (int)((int64_t)elapsed_ms * steps / duration_ms);
+}
+
+// Cues are placed by remaining time so resuming replans them against the new deadline
+static void plan_next_cue(TimerState *timer, int64_t now) {
+    int32_t remaining = get_remaining_ms(timer, now);
+    int32_t cue_remaining = 0;
+    
+    timer->cue_kind = CUE_NONE;
+    if (timer->mode == MODE_FILM && timer->stage == STAGE_DEVELOP) {
+        TimerConfig config = get_timer_config(timer->id, timer->mode);
+        int32_t elapsed = (int32_t)config.timing_array[timer->stage] * 1000 - remaining;
+        int32_t next_agitation = (elapsed / AGITATION_INTERVAL_MS + 1) * AGITATION_INTERVAL_MS;
+        cue_remaining = (int32_t)config.timing_array[timer->stage] * 1000 - next_agitation;
+        if (cue_remaining > PRE_END_WARNING_MS) {
+            timer->cue_kind = CUE_AGITATE;
+        }
+    }
+    if (timer->cue_kind == CUE_NONE && remaining > PRE_END_WARNING_MS) {
+        cue_remaining = PRE_END_WARNING_MS;
+        timer->cue_kind = CUE_WARNING;
+    }
+    timer->cue_ms = timer->deadline_ms - cue_remaining;
+}
+
+static int s_cues_fired[CUE_REMINDER + 1];
+
+int get_cues_fired(CueKind kind) {
+    return s_cues_fired[kind];
+}
+
+void clear_cues_fired(void) {
+    memset(s_cues_fired, 0, sizeof(s_cues_fired));
+}
+
+// A timer stays on the event heap while it is running or has a cue pending
+static bool has_pending_events(TimerState *timer) {
+    return timer->running || timer->cue_kind != CUE_NONE;
+}
+
+static int64_t get_next_event_ms(TimerState *timer, int64_t now) {
+    int64_t next;
+    if (!timer->running) {
+        return timer->cue_ms;
+    } else if (timer->id != s_scheduler_active_timer) {
+        next = timer->deadline_ms;
+    } else if (use_minute_resolution(timer, now)) {
+        next = now + get_minute_tick_delay(get_remaining_ms(timer, now));
+    } else {
+        next = now + get_tick_delay(get_remaining_ms(timer, now));
+    }
+    if (timer->cue_kind != CUE_NONE && timer->cue_ms < next) {
+        next = timer->cue_ms;
+    }
+    return next;
+}
+
+static bool heap_less(int a, int b) {
+    return s_timers[s_event_heap[a]]->next_event_ms < s_timers[s_event_heap[b]]->next_event_ms;
+}
+
+static void heap_swap(int a, int b) {
+    uint8_t tmp = s_event_heap[a];
+    s_event_heap[a] = s_event_heap[b];
+    s_event_heap[b] = tmp;
+    s_heap_pos[s_event_heap[a]] = a;
+    s_heap_pos[s_event_heap[b]] = b;
+}
+
+static void heap_sift_up(int pos) {
+    while (pos > 0 && heap_less(pos, (pos - 1) / 2)) {
+        heap_swap(pos, (pos - 1) / 2);
+        pos = (pos - 1) / 2;
+    }
+}
+
+static void heap_sift_down(int pos) {
+    for (;;) {
+        int smallest = pos;
+        int left = 2 * pos + 1;
+        int right = left + 1;
+        if (left < s_heap_size && heap_less(left, smallest)) {
+            smallest = left;
+        }
+        if (right < s_heap_size && heap_less(right, smallest)) {
+            smallest = right;
+        }
+        if (smallest == pos) {
+            return;
+        }
+        heap_swap(pos, smallest);
+        pos = smallest;
+    }
+}
+
+static void heap_remove(int index) {
+    int pos = s_heap_pos[index];
+    if (pos < 0) {
+        return;
+    }
+    s_heap_size--;
+    if (pos != s_heap_size) {
+        heap_swap(pos, s_heap_size);
+        heap_sift_down(pos);
+        heap_sift_up(pos);
+    }
+    s_heap_pos[index] = -1;
+}
+
+static void heap_update(int index) {
+    int pos = s_heap_pos[index];
+    if (pos < 0) {
+        pos = s_heap_size++;
+        s_event_heap[pos] = index;
+        s_heap_pos[index] = pos;
+    }
+    heap_sift_down(pos);
+    heap_sift_up(s_heap_pos[index]);
+}
+
+static void scheduler_arm(int64_t now) {
+    if (s_heap_size == 0) {
+        s_tick_delay_ms = 0;
+        return;
+    }
+    int64_t delay = s_timers[s_event_heap[0]]->next_event_ms - now;
+    s_tick_armed_ms = now;
+    s_tick_delay_ms = delay > 0 ? (uint32_t)delay : 1;
+}
+
+static void scheduler_update(TimerState *timer, int64_t now) {
+    int index = timer->id - 1;
+    if (timer->running && timer->cue_kind == CUE_NONE) {
+        plan_next_cue(timer, now);
+    }
+    if (has_pending_events(timer)) {
+        timer->next_event_ms = get_next_event_ms(timer, now);
+        heap_update(index);
+    } else {
+        heap_remove(index);
+    }
+    scheduler_arm(now);
+}
+
+void start_timer(TimerState *timer) {
+    int64_t now = now_ms();
+    timer->running = true;
+    timer->paused = false;
+    timer->deadline_ms = now + timer->remaining_ms;
+    timer->cue_kind = CUE_NONE;
+    scheduler_update(timer, now);
+}
+
+// A button press switches the displayed countdown to seconds for a while
+void note_interaction(int64_t now) {
+    TimerState *timer = s_timers[s_scheduler_active_timer - 1];
+    s_last_interaction_ms = now;
+    if (timer->running) {
+        timer->seconds_remaining = (get_remaining_ms(timer, now) + 999) / 1000;
+    }
+    scheduler_update(timer, now);
+}
+
+// Count a due cue; a reminder only goes off while the next stage is waiting
+static void fire_cue(TimerState *timer) {
+    CueKind kind = timer->cue_kind;
+    timer->cue_kind = CUE_NONE;
+    if (kind != CUE_REMINDER || !timer->running) {
+        s_cues_fired[kind]++;
+    }
+}
+
+// Drain gap the app reads from its settings (the test Settings lacks it)
+static uint8_t s_drain_gap_s = 10;
+
+// Bring one running timer up to date, completing its stage if the deadline
+// passed (mirrors the app, minus the completion vibration)
+static void service_timer(TimerState *timer, int64_t now) {
+    int32_t remaining = get_remaining_ms(timer, now);
+    
+    if (remaining > 0) {
+        timer->seconds_remaining = (remaining + 999) / 1000;
+        return;
+    }
+    
+    TimerConfig config = get_timer_config(timer->id, timer->mode);
+    
+    if (timer->draining) {
+        timer->draining = false;
+        timer->deadline_ms += (int64_t)config.timing_array[timer->stage] * 1000;
+        timer->seconds_remaining = (get_remaining_ms(timer, now) + 999) / 1000;
+        journal_write();
+        return;
+    }
+    
+    timer->stage++;
+    if (timer->stage > get_max_stage(timer)) {
+        timer->stage = STAGE_DEVELOP;
+        timer->running = false;
+        timer->auto_advance = false;
+        timer->cue_kind = CUE_NONE;
+        set_timer_duration(timer, 0);
+    } else if (timer->auto_advance) {
+        int seconds = timer->gap_s;
+        timer->draining = timer->gap_s > 0;
+        if (!timer->draining) {
+            seconds = config.timing_array[timer->stage];
+        }
+        timer->deadline_ms += (int64_t)seconds * 1000;
+        timer->seconds_remaining = (get_remaining_ms(timer, now) + 999) / 1000;
+    } else {
+        set_timer_duration(timer, config.timing_array[timer->stage]);
+        timer->running = false;
+        timer->cue_kind = CUE_REMINDER;
+        timer->cue_ms = now + STAGE_REMINDER_MS;
+    }
+    journal_write();
+}
+
+// Simulate the shared tick firing at the mock time
+void scheduler_tick(void) {
+    int64_t now = now_ms();
+    s_tick_count++;
+    s_last_tick_serviced = 0;
+    correct_clock_jump(now);
+    while (s_heap_size > 0 && s_timers[s_event_heap[0]]->next_event_ms <= now) {
+        int index = s_event_heap[0];
+        TimerState *timer = s_timers[index];
+        s_last_tick_serviced++;
+        if (timer->cue_kind != CUE_NONE && timer->cue_ms <= now) {
+            fire_cue(timer);
+        }
+        if (timer->running) {
+            service_timer(timer, now);
+        }
+        
+        if (timer->running && timer->cue_kind == CUE_NONE) {
+            plan_next_cue(timer, now);
+        }
+        if (has_pending_events(timer)) {
+            timer->next_event_ms = get_next_event_ms(timer, now);
+            heap_sift_down(0);
+        } else {
+            heap_remove(index);
+        }
+    }
+    scheduler_arm(now);
+}
+
+// Restore both timers from the newest journal record, catching up the time
+// spent closed: stages whose deadline passed complete right away, and an
+// auto-advanced process walks through every transition it missed. Without
+// resume the timers are only shown, as while a worker's records are pending.
+void restore_timer_state(bool resume) {
+    TimerJournal journal;
+    if (!load_timer_journal(&journal)) {
+        return;
+    }
+    
+    int64_t now = now_ms();
+    for (int i = 0; i < NUM_TIMERS; i++) {
+        TimerSnapshot *snapshot = &journal.timers[i];
+        TimerState *timer = s_timers[i];
+        TimerConfig config = get_timer_config(i + 1, (TimerMode)snapshot->mode);
+        timer->mode = (TimerMode)snapshot->mode;
+        timer->paper_type = (PaperType)snapshot->paper_type;
+        timer->max_stages = config.stage_count;
+        timer->stage = (TimerStage)snapshot->stage;
+        timer->running = snapshot->running;
+        timer->paused = snapshot->paused;
+        timer->auto_advance = snapshot->auto_advance;
+        timer->draining = snapshot->draining;
+        if (timer->auto_advance) {
+            build_process_schedule(timer, s_drain_gap_s);
+        }
+        set_timer_duration(timer, 0);
+        timer->remaining_ms = snapshot->remaining_ms;
+        timer->deadline_ms = snapshot->deadline_ms;
+        
+        int32_t remaining = get_remaining_ms(timer, now);
+        timer->seconds_remaining = (remaining + 999) / 1000;
+        if (timer->running && resume) {
+            do {
+                service_timer(timer, now);
+            } while (timer->running && get_remaining_ms(timer, now) == 0);
+            scheduler_update(timer, now);
+        }
+    }
+}
+
+// Settings record (the test Settings has only the five original flags)
+#define SETTINGS_FLAG_VIBRATION     (1 << 0)
+#define SETTINGS_FLAG_BACKLIGHT     (1 << 1)
+#define SETTINGS_FLAG_INVERT_TIMER1 (1 << 2)
+#define SETTINGS_FLAG_INVERT_TIMER2 (1 << 3)
+#define SETTINGS_FLAG_INVERT_MENU   (1 << 4)
+
+static uint32_t crc32(const void *data, size_t length);
+
+void pack_settings(SettingsRecord *record) {
+    memset(record, 0, sizeof(*record));
+    record->version = SETTINGS_RECORD_VERSION;
+    record->flags = (s_settings.vibration_enabled ? SETTINGS_FLAG_VIBRATION : 0) |
+                    (s_settings.backlight_enabled ? SETTINGS_FLAG_BACKLIGHT : 0) |
+                    (s_settings.invert_timer1_colors ? SETTINGS_FLAG_INVERT_TIMER1 : 0) |
+                    (s_settings.invert_timer2_colors ? SETTINGS_FLAG_INVERT_TIMER2 : 0) |
+                    (s_settings.invert_menu_colors ? SETTINGS_FLAG_INVERT_MENU : 0);
+    record->timer_count = 2;
+    record->drain_gap_s = 10;
+    for (int i = 0; i < 4; i++) {
+        record->film_times[i] = (uint16_t)film_times[i];
+        record->rc_print_times[i] = (uint16_t)rc_print_times[i];
+    }
+    for (int i = 0; i < 6; i++) {
+        record->fiber_print_times[i] = (uint16_t)fiber_print_times[i];
+    }
+    record->crc = crc32(record, offsetof(SettingsRecord, crc));
+}
+
+bool unpack_settings(const SettingsRecord *record, int length) {
+    if (length != (int)sizeof(*record) || record->version != SETTINGS_RECORD_VERSION ||
+        record->crc != crc32(record, offsetof(SettingsRecord, crc))) {
+        return false;
+    }
+    s_settings.vibration_enabled = record->flags & SETTINGS_FLAG_VIBRATION;
+    s_settings.backlight_enabled = record->flags & SETTINGS_FLAG_BACKLIGHT;
+    s_settings.invert_timer1_colors = record->flags & SETTINGS_FLAG_INVERT_TIMER1;
+    s_settings.invert_timer2_colors = record->flags & SETTINGS_FLAG_INVERT_TIMER2;
+    s_settings.invert_menu_colors = record->flags & SETTINGS_FLAG_INVERT_MENU;
+    for (int i = 0; i < 4; i++) {
+        film_times[i] = record->film_times[i];
+        rc_print_times[i] = record->rc_print_times[i];
+    }
+    for (int i = 0; i < 6; i++) {
+        fiber_print_times[i] = record->fiber_print_times[i];
+    }
+    return true;
+}
+
+// Write-behind settings persistence (mirrors the app). The flush AppTimer
+// is a deadline on the mock clock, fired by service_settings_flush_timer().
+static bool s_settings_dirty = false;
+static bool s_settings_flush_timer = false;
+static int64_t s_settings_flush_due_ms = 0;
+static uint32_t s_settings_writes = 0;
+
+static void write_settings_record(void) {
+    extern bool persist_write_called;
+    extern int persist_key;
+    extern int persist_size;
+    SettingsRecord record;
+    pack_settings(&record);
+    persist_write_called = true;
+    persist_key = SETTINGS_RECORD_KEY;
+    persist_size = sizeof(record);
+    s_settings_writes++;
+}
+
+void flush_settings(void) {
+    s_settings_flush_timer = false;
+    if (s_settings_dirty) {
+        write_settings_record();
+        s_settings_dirty = false;
+    }
+}
+
+// Each edit pushes the idle flush back by the full timeout
+void mark_settings_dirty(void) {
+    s_settings_dirty = true;
+    s_settings_flush_timer = true;
+    s_settings_flush_due_ms = now_ms() + SETTINGS_FLUSH_IDLE_MS;
+}
+
+// The app's menu unload handler and focus handler
+void settings_menu_closed(void) {
+    flush_settings();
+}
+
+void settings_focus_changed(bool in_focus) {
+    if (!in_focus) {
+        flush_settings();
+    }
+}
+
+bool service_settings_flush_timer(void) {
+    if (!s_settings_flush_timer || now_ms() < s_settings_flush_due_ms) {
+        return false;
+    }
+    flush_settings();
+    return true;
+}
+
+bool is_settings_flush_timer_armed(void) {
+    return s_settings_flush_timer;
+}
+
+uint32_t get_settings_writes(void) {
+    return s_settings_writes;
+}
+
+void clear_settings_writes(void) {
+    s_settings_dirty = false;
+    s_settings_flush_timer = false;
+    s_settings_writes = 0;
+}
+
+// A/B journal slots standing in for the two persist keys
+static TimerJournal s_journal_slots[2];
+static bool s_journal_slot_written[2];
+static uint32_t s_journal_sequence = 0;
+
+static uint32_t crc32(const void *data, size_t length) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t journal_crc(const TimerJournal *journal) {
+    return crc32(journal, offsetof(TimerJournal, crc));
+}
+
+void journal_write(void) {
+    TimerJournal journal;
+    memset(&journal, 0, sizeof(journal));
+    journal.sequence = ++s_journal_sequence;
+    for (int i = 0; i < NUM_TIMERS; i++) {
+        TimerState *timer = s_timers[i];
+        journal.timers[i] = (TimerSnapshot){
+            .running = timer->running,
+            .paused = timer->paused,
+            .mode = timer->mode,
+            .paper_type = timer->paper_type,
+            .stage = timer->stage,
+            .auto_advance = timer->auto_advance,
+            .draining = timer->draining,
+            .remaining_ms = timer->remaining_ms,
+            .deadline_ms = timer->deadline_ms
+        };
+    }
+    journal.crc = journal_crc(&journal);
+    
+    int slot = journal.sequence & 1;
+    s_journal_slots[slot] = journal;
+    s_journal_slot_written[slot] = true;
+}
+
+// Pick the newest slot whose CRC still matches
+bool load_timer_journal(TimerJournal *journal) {
+    TimerJournal *a = &s_journal_slots[0];
+    TimerJournal *b = &s_journal_slots[1];
+    bool a_valid = s_journal_slot_written[0] && a->crc == journal_crc(a);
+    bool b_valid = s_journal_slot_written[1] && b->crc == journal_crc(b);
+    
+    if (b_valid && (!a_valid || (int32_t)(b->sequence - a->sequence) > 0)) {
+        *journal = *b;
+    } else if (a_valid) {
+        *journal = *a;
+    }
+    return a_valid || b_valid;
+}
+
+TimerJournal* get_journal_slot(int slot) {
+    return &s_journal_slots[slot];
+}
+
+void clear_journal(void) {
+    memset(s_journal_slots, 0, sizeof(s_journal_slots));
+    s_journal_slot_written[0] = false;
+    s_journal_slot_written[1] = false;
+    s_journal_sequence = 0;
+}
+
+// Time editor write-back (mirrors time_editor_disappear): idle timers pick
+// up the new duration and are journaled so a relaunch restores it
+static void reload_idle_timers(void) {
+    for (int i = 0; i < NUM_TIMERS; i++) {
+        TimerState *timer = s_timers[i];
+        if (!timer->running && !timer->paused) {
+            TimerConfig config = get_timer_config(timer->id, timer->mode);
+            set_timer_duration(timer, config.timing_array[timer->stage]);
+        }
+    }
+}
+
+void commit_time_edit(int *target, int value) {
+    if (*target == value) {
+        return;
+    }
+    *target = value;
+    reload_idle_timers();
+    journal_write();
+    mark_settings_dirty();
+}
+
 // Timer control functions
 void reset_timer(TimerState *timer) {
     if (timer->timer_handle) {
@@ -158,20 +821,19 @@ void reset_timer(TimerState *timer) {
     }
     timer->running = false;
     timer->paused = false;
+    timer->cue_kind = CUE_NONE;
     timer->stage = STAGE_DEVELOP;
     
-    // Determine which timer this is (1 or 2)
-    int timer_number = (timer == &s_timer1) ? 1 : 2;
-    
     // Get timer configuration
-    TimerConfig config = get_timer_config(timer_number, timer->mode);
+    TimerConfig config = get_timer_config(timer->id, timer->mode);
     
     // Update timer properties based on configuration
     timer->paper_type = config.paper_type;
     timer->max_stages = config.stage_count;
     
     // Set initial timing for develop stage
-    timer->seconds_remaining = config.timing_array[STAGE_DEVELOP];
+    set_timer_duration(timer, config.timing_array[STAGE_DEVELOP]);
+    scheduler_update(timer, now_ms());
 }
 
 void pause_timer(TimerState *timer) {
@@ -180,13 +842,17 @@ void pause_timer(TimerState *timer) {
         app_timer_cancel_called = true;
         timer->timer_handle = NULL;
     }
+    // Bank the time left so resume picks up mid-second where we stopped
+    timer->remaining_ms = get_remaining_ms(timer, now_ms());
+    timer->seconds_remaining = (timer->remaining_ms + 999) / 1000;
     timer->paused = true;
     timer->running = false;
+    timer->cue_kind = CUE_NONE;
+    scheduler_update(timer, now_ms());
 }
 
 void resume_timer(TimerState *timer) {
-    timer->paused = false;
-    timer->running = true;
+    start_timer(timer);
     // Simulate timer registration
     extern bool app_timer_register_called;
     app_timer_register_called = true;
@@ -2,6 +2,7 @@
 #define SETTINGS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 // Settings structure
 typedef struct {
@@ -32,8 +33,16 @@ typedef enum {
     PAPER_FIBER
 } PaperType;
 
+typedef enum {
+    CUE_NONE,
+    CUE_AGITATE,
+    CUE_WARNING,
+    CUE_REMINDER
+} CueKind;
+
 // Timer state structure
 typedef struct {
+    uint8_t id;
     bool running;
     bool paused;
     TimerMode mode;
@@ -41,14 +50,69 @@ typedef struct {
     PaperType paper_type;
     int max_stages;
     int seconds_remaining;
+    int32_t remaining_ms;
+    int64_t deadline_ms;
+    int64_t next_event_ms;
+    CueKind cue_kind;
+    int64_t cue_ms;
+    bool auto_advance;
+    bool draining;
+    uint8_t gap_s;
+    uint16_t stage_end_s[6];
     void *timer_handle;
 } TimerState;
 
-// Persistent storage keys
+// Compact copy of one timer, journaled on every transition (mirrors the app)
+typedef struct {
+    uint8_t running;
+    uint8_t paused;
+    uint8_t mode;
+    uint8_t paper_type;
+    uint8_t stage;
+    uint8_t auto_advance;
+    uint8_t draining;
+    int32_t remaining_ms;
+    int64_t deadline_ms;
+} TimerSnapshot;
+
+// Two-slot timer journal (mirrors the app, sized for the two test timers)
+typedef struct {
+    uint32_t sequence;
+    TimerSnapshot timers[2];
+    uint32_t crc;
+} TimerJournal;
+
+// Persistent storage keys (mirrors the app; 1, 2, 4 and 5 are legacy keys
+// read only to migrate old installs)
 #define SETTINGS_KEY 1
 #define FILM_TIMES_KEY 2
-#define RC_PRINT_TIMES_KEY 3
-#define FIBER_PRINT_TIMES_KEY 4
+#define RC_PRINT_TIMES_KEY 4
+#define FIBER_PRINT_TIMES_KEY 5
+#define TIMER_JOURNAL_A_KEY 6
+#define TIMER_JOURNAL_B_KEY 7
+#define SETTINGS_RECORD_KEY 8
+
+// Versioned settings record (mirrors the app)
+#define SETTINGS_RECORD_VERSION 1
+
+typedef struct {
+    uint8_t version;
+    uint8_t flags;
+    uint8_t timer_count;
+    uint8_t drain_gap_s;
+    uint16_t film_times[4];
+    uint16_t rc_print_times[4];
+    uint16_t fiber_print_times[6];
+    uint32_t crc;
+} SettingsRecord;
+
+// Deadline engine tolerance (mirrors the app)
+#define CLOCK_JUMP_TOLERANCE_MS 2000
+#define FINAL_MINUTE_MS 60000
+#define INTERACTION_WINDOW_MS 5000
+#define AGITATION_INTERVAL_MS 30000
+#define PRE_END_WARNING_MS 10000
+#define STAGE_REMINDER_MS 2000
 
 // Function declarations for testing
 Settings* get_settings(void);
@@ -64,6 +128,66 @@ void pause_timer(TimerState *timer);
 void resume_timer(TimerState *timer);
 TimerStage get_max_stage(TimerState *timer);
 
+// Deadline engine and shared tick (wall clock is mocked via set_mock_now_ms)
+void set_mock_now_ms(int64_t now);
+int64_t get_mock_now_ms(void);
+void set_timer_duration(TimerState *timer, int seconds);
+int32_t get_remaining_ms(TimerState *timer, int64_t now);
+uint32_t get_tick_delay(int32_t remaining);
+void set_scheduler_active_timer(int timer_number);
+uint32_t get_armed_tick_delay(void);
+int get_heap_size(void);
+int get_last_tick_serviced(void);
+uint32_t get_tick_count(void);
+void start_timer(TimerState *timer);
+void scheduler_tick(void);
+
+// Adaptive tick resolution
+void note_interaction(int64_t now);
+bool use_minute_resolution(TimerState *timer, int64_t now);
+void format_countdown(char *buffer, int size, TimerState *timer, int64_t now);
+
+// Agitation and pre-end warning cues serviced by the shared tick
+int get_cues_fired(CueKind kind);
+void clear_cues_fired(void);
+
+// Auto-advance process schedule
+void build_process_schedule(TimerState *timer, uint8_t gap_s);
+int32_t get_process_remaining_ms(TimerState *timer, int64_t now);
+
+// Elapsed-fraction fill of the current stage's indicator
+int get_stage_progress(TimerState *timer, int64_t now, int steps);
+
+// Restore from the journal with elapsed-time catch-up
+void restore_timer_state(bool resume);
+
+// Settings record packing; unpacking rejects truncated, corrupted or
+// unknown-version records and leaves the settings untouched
+void pack_settings(SettingsRecord *record);
+bool unpack_settings(const SettingsRecord *record, int length);
+
+// Write-behind settings persistence: edits mark the settings dirty and the
+// record is written on flush, menu close, focus loss or once the idle timer
+// (a mock deadline on the wall clock) expires
+#define SETTINGS_FLUSH_IDLE_MS 10000
+void mark_settings_dirty(void);
+void flush_settings(void);
+void settings_menu_closed(void);
+void settings_focus_changed(bool in_focus);
+bool service_settings_flush_timer(void);
+bool is_settings_flush_timer_armed(void);
+uint32_t get_settings_writes(void);
+void clear_settings_writes(void);
+
+// Crash-safe A/B journal (slots are in-memory stand-ins for persist keys)
+void journal_write(void);
+bool load_timer_journal(TimerJournal *journal);
+TimerJournal* get_journal_slot(int slot);
+void clear_journal(void);
+
+// Time editor write-back when the editor closes
+void commit_time_edit(int *target, int value);
+
 // Utility functions for testing
 char* timer_to_string(TimerState *timer);
 char* settings_to_string(Settings *settings);
@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
 
 // Mock color definitions for testing
 typedef enum {
@@ -26,14 +27,14 @@ static TimerState* get_active_timer(void) {
     return active_timer == 1 ? get_timer1() : get_timer2();
 }
 
-static void update_timer_text(void) {
+static void format_timer_text(void) {
     TimerState *timer = get_active_timer();
     int minutes = timer->seconds_remaining / 60;
     int seconds = timer->seconds_remaining % 60;
     snprintf(mock_timer_buffer, sizeof(mock_timer_buffer), "%02d:%02d", minutes, seconds);
 }
 
-static void update_mode_text(void) {
+static void format_mode_text(void) {
     TimerState *timer = get_active_timer();
     char mode_char = (timer->mode == MODE_FILM) ? 'F' : 'P';
     const char *stage_text = "Unknown";
@@ -50,7 +51,7 @@ static void update_mode_text(void) {
              timer->paused ? "PAUSED" : "");
 }
 
-static void update_timer_name_text(void) {
+static void format_timer_name_text(void) {
     snprintf(mock_timer_name_buffer, sizeof(mock_timer_name_buffer), "Timer %d", active_timer);
 }
 
@@ -75,6 +76,295 @@ static DisplayTheme get_display_theme(int timer_number) {
     };
 }
 
+// Per-timer theme cache (mirrors the app): resolved when settings load or an
+// invert toggle fires, and only a pointer swap when the active timer changes
+static DisplayTheme s_timer_themes[2];
+static const DisplayTheme *s_theme = &s_timer_themes[0];
+static int s_theme_resolves = 0;
+
+static void resolve_display_themes(void) {
+    for (int i = 0; i < 2; i++) {
+        s_timer_themes[i] = get_display_theme(i + 1);
+    }
+    s_theme_resolves++;
+}
+
+// Mode and name lines cached per timer (mirrors the app on rectangular
+// displays). A reformat clears the shown pointer, so a line the canvas
+// already draws keeps its pointer until the fields it is built from change.
+#define TEXT_CACHE_INVALID 0xFFFF
+typedef struct {
+    uint16_t mode_key;
+    int32_t name_minutes;
+    int32_t name_transition;
+    char mode_text[32];
+    char name_text[24];
+} TextCache;
+static TextCache s_text_cache[2];
+static const char *s_shown_mode_text = NULL;
+static const char *s_shown_name_text = NULL;
+
+static int64_t now_ms(void) {
+    return get_mock_now_ms();
+}
+
+// Stand-in for the watch's clock setting
+static bool clock_is_24h_style(void) {
+    return true;
+}
+
+static uint16_t get_mode_key(TimerState *timer) {
+    uint16_t status = timer->paused ? 2 : (timer->running ? (timer->draining ? 3 : 1) : 0);
+    return (uint16_t)(timer->mode | (timer->paper_type << 1) | (timer->stage << 2) | (status << 5));
+}
+
+static const char *get_mode_text(TimerState *timer) {
+    TextCache *cache = &s_text_cache[timer->id - 1];
+    uint16_t key = get_mode_key(timer);
+    
+    if (key != cache->mode_key) {
+        char mode_char = (timer->mode == MODE_FILM) ? 'F' : 'P';
+        
+        const char *paper_type = "Film";
+        if (timer->mode == MODE_PRINT) {
+            paper_type = (timer->paper_type == PAPER_RC) ? "RC" : "FB";
+        }
+        
+        const char *stage_text = "Unknown";
+        switch (timer->stage) {
+            case STAGE_DEVELOP: stage_text = "Dev"; break;
+            case STAGE_STOP: stage_text = "Stop"; break;
+            case STAGE_FIX: stage_text = "Fix"; break;
+            case STAGE_WASH: stage_text = "Wash"; break;
+            case STAGE_HYPO_CLEAR: stage_text = "HC"; break;
+            case STAGE_WASH2: stage_text = "Wash2"; break;
+        }
+        
+        const char *status = timer->paused ? "PAUSED" :
+                             (timer->draining && timer->running) ? "POUR" :
+                             (timer->running ? "RUNNING" : "");
+        if (status[0] != '\0') {
+            snprintf(cache->mode_text, sizeof(cache->mode_text), "%c | %s | %s | %s",
+                     mode_char, paper_type, stage_text, status);
+        } else {
+            snprintf(cache->mode_text, sizeof(cache->mode_text), "%c | %s | %s",
+                     mode_char, paper_type, stage_text);
+        }
+        cache->mode_key = key;
+        s_shown_mode_text = NULL;
+    }
+    
+    return cache->mode_text;
+}
+
+static const char *get_name_text(TimerState *timer) {
+    TextCache *cache = &s_text_cache[timer->id - 1];
+    int32_t minutes = -1;
+    int32_t transition = -1;
+    
+    if (timer->auto_advance && (timer->running || timer->paused)) {
+        minutes = (get_process_remaining_ms(timer, now_ms()) + 59999) / 60000;
+        if (timer->running) {
+            transition = (int32_t)(timer->deadline_ms / 60000);
+        }
+    }
+    
+    if (minutes != cache->name_minutes || transition != cache->name_transition) {
+        char clock[8] = "";
+        if (transition >= 0) {
+            time_t transition_time = (time_t)(timer->deadline_ms / 1000);
+            strftime(clock, sizeof(clock), clock_is_24h_style() ? "%H:%M" : "%I:%M",
+                     localtime(&transition_time));
+        }
+        
+        if (minutes < 0) {
+            snprintf(cache->name_text, sizeof(cache->name_text), "Timer %d", timer->id);
+        } else if (transition < 0) {
+            snprintf(cache->name_text, sizeof(cache->name_text), "Timer %d | %dm",
+                     timer->id, (int)minutes);
+        } else {
+            snprintf(cache->name_text, sizeof(cache->name_text), "Timer %d | %dm | %s",
+                     timer->id, (int)minutes, clock);
+        }
+        cache->name_minutes = minutes;
+        cache->name_transition = transition;
+        s_shown_name_text = NULL;
+    }
+    
+    return cache->name_text;
+}
+
+static void invalidate_text_cache(void) {
+    for (int i = 0; i < 2; i++) {
+        s_text_cache[i].mode_key = TEXT_CACHE_INVALID;
+        s_text_cache[i].name_minutes = TEXT_CACHE_INVALID;
+    }
+    s_shown_mode_text = NULL;
+    s_shown_name_text = NULL;
+}
+
+// Countdown cell diff (mirrors the app's countdown cells): returns the number of
+// cells that changed and flags a relayout when the text changes shape
+static char s_digit_text[7];
+
+static int glyph_class(char c) {
+    return (c >= '0' && c <= '9') ? 0 : (c == ':' ? 1 : 2);
+}
+
+static int set_digit_text(const char *text, bool *relayout) {
+    int len = strlen(text);
+    int changed = 0;
+    *relayout = len != (int)strlen(s_digit_text);
+    for (int i = 0; i < len; i++) {
+        if (text[i] == s_digit_text[i]) {
+            continue;
+        }
+        *relayout |= glyph_class(text[i]) != glyph_class(s_digit_text[i]);
+        changed++;
+    }
+    strncpy(s_digit_text, text, 6);
+    return changed;
+}
+
+// Change-driven render commit (mirrors the app on rectangular displays,
+// with the layout's indicator rects reduced to their width)
+#define DIRTY_TIME  (1 << 0)
+#define DIRTY_MODE  (1 << 1)
+#define DIRTY_NAME  (1 << 2)
+#define DIRTY_THEME (1 << 3)
+#define DIRTY_ALL   (DIRTY_TIME | DIRTY_MODE | DIRTY_NAME | DIRTY_THEME)
+static uint8_t s_dirty = DIRTY_ALL;
+static uint32_t s_frame_count = 0;
+static int s_shown_progress = 0;
+
+static bool s_main_window_shown = true;
+static bool s_app_in_focus = true;
+static bool s_split_view = false;
+
+#define INDICATOR_SPACING 2
+#define INDICATORS_WIDTH 124
+
+static bool is_main_window_visible(void) {
+    return s_main_window_shown && s_app_in_focus;
+}
+
+static int get_split_partner(int timer_number, bool split_view, int timer_count);
+
+static bool is_split_view(void) {
+    return get_split_partner(active_timer, s_split_view, 2) != 0;
+}
+
+static int get_indicator_width(int width, int max_stages) {
+    return (width - (max_stages - 1) * INDICATOR_SPACING) / max_stages;
+}
+
+static int get_progress_steps(TimerState *timer) {
+    return get_indicator_width(INDICATORS_WIDTH, timer->max_stages);
+}
+
+typedef struct {
+    TimerState *timer;
+    const char *name_text;
+    const char *mode_text;
+    char time_text[8];
+    int progress;
+} SplitPane;
+static SplitPane s_split_panes[2];
+
+static bool update_timer_text(void) {
+    char buffer[sizeof(s_digit_text)];
+    bool relayout;
+    format_countdown(buffer, sizeof(buffer), get_active_timer(), now_ms());
+    return set_digit_text(buffer, &relayout) > 0 || relayout;
+}
+
+static bool update_mode_text(void) {
+    const char *text = get_mode_text(get_active_timer());
+    if (s_shown_mode_text == text) {
+        return false;
+    }
+    s_shown_mode_text = text;
+    return true;
+}
+
+static bool update_progress(void) {
+    TimerState *timer = get_active_timer();
+    int progress = get_stage_progress(timer, now_ms(), get_progress_steps(timer));
+    if (progress == s_shown_progress) {
+        return false;
+    }
+    s_shown_progress = progress;
+    return true;
+}
+
+static bool prepare_split_panes(void) {
+    int top = (active_timer % 2 == 1) ? active_timer : active_timer - 1;
+    bool changed = false;
+    
+    for (int i = 0; i < 2; i++) {
+        SplitPane *pane = &s_split_panes[i];
+        char time_text[sizeof(pane->time_text)];
+        pane->timer = (top - 1 + i == 0) ? get_timer1() : get_timer2();
+        pane->name_text = get_name_text(pane->timer);
+        pane->mode_text = get_mode_text(pane->timer);
+        format_countdown(time_text, sizeof(time_text), pane->timer, now_ms());
+        if (strcmp(time_text, pane->time_text) != 0) {
+            strcpy(pane->time_text, time_text);
+            changed = true;
+        }
+        
+        int steps = get_indicator_width(INDICATORS_WIDTH, pane->timer->max_stages);
+        int progress = get_stage_progress(pane->timer, now_ms(), steps);
+        if (progress != pane->progress) {
+            pane->progress = progress;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+static bool update_timer_name_text(void) {
+    const char *text = get_name_text(get_active_timer());
+    if (s_shown_name_text == text) {
+        return false;
+    }
+    s_shown_name_text = text;
+    return true;
+}
+
+static void render_commit(void) {
+    if (!s_dirty || !is_main_window_visible()) {
+        return;
+    }
+    
+    bool changed = (s_dirty & (DIRTY_MODE | DIRTY_THEME)) != 0;
+    if (s_dirty & DIRTY_THEME) {
+        s_theme = &s_timer_themes[active_timer - 1];
+    }
+    if (is_split_view()) {
+        changed |= (s_dirty & DIRTY_NAME) != 0;
+        changed |= prepare_split_panes();
+    } else {
+        if (s_dirty & DIRTY_TIME) {
+            changed |= update_timer_text();
+        }
+        if (s_dirty & DIRTY_MODE) {
+            changed |= update_mode_text();
+        }
+        if (s_dirty & DIRTY_NAME) {
+            changed |= update_timer_name_text();
+        }
+        if (s_dirty & (DIRTY_TIME | DIRTY_MODE)) {
+            changed |= update_progress();
+        }
+    }
+    s_dirty = 0;
+    
+    if (changed) {
+        s_frame_count++;
+    }
+}
+
 // Enhanced mode text update with paper type support
 static void update_mode_text_enhanced(void) {
     TimerState *timer = get_active_timer();
@@ -115,58 +405,58 @@ void test_display(void) {
     // Test 1: Test timer text formatting for different times
     timer1->seconds_remaining = 125;  // 2:05
     active_timer = 1;
-    update_timer_text();
+    format_timer_text();
     TEST_ASSERT_EQUAL_STRING(mock_timer_buffer, "02:05");
     
     // Test 2: Test timer text for 0 seconds
     timer1->seconds_remaining = 0;
-    update_timer_text();
+    format_timer_text();
     TEST_ASSERT_EQUAL_STRING(mock_timer_buffer, "00:00");
     
     // Test 3: Test timer text for 1 minute 30 seconds
     timer1->seconds_remaining = 90;
-    update_timer_text();
+    format_timer_text();
     TEST_ASSERT_EQUAL_STRING(mock_timer_buffer, "01:30");
     
     // Test 4: Test mode text formatting
     timer1->mode = MODE_FILM;
     timer1->stage = STAGE_DEVELOP;
     timer1->paused = false;
-    update_mode_text();
+    format_mode_text();
     TEST_ASSERT_EQUAL_STRING(mock_mode_buffer, "F | Dev | ");
     
     // Test 5: Test mode text with pause
     timer1->paused = true;
-    update_mode_text();
+    format_mode_text();
     TEST_ASSERT_EQUAL_STRING(mock_mode_buffer, "F | Dev | PAUSED");
     
     // Test 6: Test mode text for different stages
     timer1->stage = STAGE_STOP;
     timer1->paused = false;
-    update_mode_text();
+    format_mode_text();
     TEST_ASSERT_EQUAL_STRING(mock_mode_buffer, "F | Stop | ");
     
     timer1->stage = STAGE_FIX;
-    update_mode_text();
+    format_mode_text();
     TEST_ASSERT_EQUAL_STRING(mock_mode_buffer, "F | Fix | ");
     
     timer1->stage = STAGE_WASH;
-    update_mode_text();
+    format_mode_text();
     TEST_ASSERT_EQUAL_STRING(mock_mode_buffer, "F | Wash | ");
     
     // Test 7: Test mode text for print mode
     timer1->mode = MODE_PRINT;
     timer1->stage = STAGE_DEVELOP;
-    update_mode_text();
+    format_mode_text();
     TEST_ASSERT_EQUAL_STRING(mock_mode_buffer, "P | Dev | ");
     
     // Test 8: Test timer name text
     active_timer = 1;
-    update_timer_name_text();
+    format_timer_name_text();
     TEST_ASSERT_EQUAL_STRING(mock_timer_name_buffer, "Timer 1");
     
     active_timer = 2;
-    update_timer_name_text();
+    format_timer_name_text();
     TEST_ASSERT_EQUAL_STRING(mock_timer_name_buffer, "Timer 2");
     
     // Test 9: Test switching between timers
@@ -174,35 +464,35 @@ void test_display(void) {
     timer1->seconds_remaining = 300;
     timer2->seconds_remaining = 60;
     
-    update_timer_text();
+    format_timer_text();
     TEST_ASSERT_EQUAL_STRING(mock_timer_buffer, "05:00");
     
     active_timer = 2;
-    update_timer_text();
+    format_timer_text();
     TEST_ASSERT_EQUAL_STRING(mock_timer_buffer, "01:00");
     
     // Test 10: Test mode text with different timer active
     active_timer = 2;
     timer2->mode = MODE_FILM;
     timer2->stage = STAGE_STOP;
-    update_mode_text();
+    format_mode_text();
     TEST_ASSERT_EQUAL_STRING(mock_mode_buffer, "F | Stop | ");
     
     // Test 11: Test buffer overflow protection
     timer1->seconds_remaining = 999999;  // Very large number
     active_timer = 1;
-    update_timer_text();
+    format_timer_text();
     TEST_ASSERT_TRUE(strlen(mock_timer_buffer) < 8);
     
     // Test 12: Test invalid stage handling
     timer1->stage = 99;  // Invalid stage
     timer1->mode = MODE_FILM;
-    update_mode_text();
+    format_mode_text();
     TEST_ASSERT_EQUAL_STRING(mock_mode_buffer, "F | Unknown | ");
     
     // Test 13: Test timer name buffer limits
     active_timer = 999;  // Large timer number
-    update_timer_name_text();
+    format_timer_name_text();
     TEST_ASSERT_TRUE(strlen(mock_timer_name_buffer) > 0);
     
     printf("All display tests passed!\n");
@@ -447,3 +737,267 @@ void test_color_theme_comprehensive(void) {
     
     printf("All comprehensive color theme tests passed!\n");
 }
+
+// Test that ticks and clicks only request a frame when something changed
+void test_render_commit(void) {
+    TimerState *timer1 = get_timer1();
+    TimerState *timer2 = get_timer2();
+    active_timer = 1;
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_mock_now_ms(1800000000000LL);
+    invalidate_text_cache();
+    memset(s_digit_text, 0, sizeof(s_digit_text));
+    
+    // Test 1: The first commit builds everything into one frame
+    s_dirty = DIRTY_ALL;
+    s_frame_count = 0;
+    render_commit();
+    TEST_ASSERT_EQUAL_INT(s_frame_count, 1);
+    TEST_ASSERT_EQUAL_STRING(s_digit_text, "01:00");
+    TEST_ASSERT_EQUAL_STRING(s_shown_mode_text, "P | RC | Dev");
+    TEST_ASSERT_EQUAL_STRING(s_shown_name_text, "Timer 1");
+    TEST_ASSERT_TRUE(s_theme == &s_timer_themes[0]);
+    
+    // Test 2: A steady-state tick only touches the digits, in one frame
+    set_timer_duration(timer1, 59);
+    s_dirty |= DIRTY_TIME;
+    render_commit();
+    TEST_ASSERT_EQUAL_STRING(s_digit_text, "00:59");
+    TEST_ASSERT_EQUAL_INT(s_frame_count, 2);
+    
+    // Test 3: Committing with nothing dirty does nothing
+    render_commit();
+    TEST_ASSERT_EQUAL_INT(s_frame_count, 2);
+    
+    // Test 4: A tick that leaves the digits unchanged requests no frame,
+    // and neither does a name line that still reads the same
+    s_dirty |= DIRTY_TIME;
+    render_commit();
+    s_dirty |= DIRTY_NAME;
+    render_commit();
+    TEST_ASSERT_EQUAL_INT(s_frame_count, 2);
+    
+    // Test 5: A stage change updates the digits, mode line and stage
+    // indicators in a single frame
+    timer1->stage = STAGE_STOP;
+    set_timer_duration(timer1, 30);
+    s_dirty |= DIRTY_TIME | DIRTY_MODE | DIRTY_NAME;
+    render_commit();
+    TEST_ASSERT_EQUAL_INT(s_frame_count, 3);
+    TEST_ASSERT_EQUAL_STRING(s_digit_text, "00:30");
+    TEST_ASSERT_EQUAL_STRING(s_shown_mode_text, "P | RC | Stop");
+    
+    // Test 6: Nothing is drawn while the settings menu covers the window;
+    // the changes wait in the dirty bits
+    s_main_window_shown = false;
+    for (int i = 0; i < 30; i++) {
+        set_timer_duration(timer1, 30 - i);
+        s_dirty |= DIRTY_TIME;
+        render_commit();
+    }
+    TEST_ASSERT_EQUAL_INT(s_frame_count, 3);
+    TEST_ASSERT_EQUAL_INT(s_dirty, DIRTY_TIME);
+    TEST_ASSERT_EQUAL_STRING(s_digit_text, "00:30");
+    
+    // Test 7: Or while a notification has focus
+    s_main_window_shown = true;
+    s_app_in_focus = false;
+    s_dirty |= DIRTY_MODE;
+    render_commit();
+    TEST_ASSERT_EQUAL_INT(s_frame_count, 3);
+    
+    // Test 8: Coming back rebuilds the whole screen once from the model
+    s_app_in_focus = true;
+    s_dirty = DIRTY_ALL;
+    render_commit();
+    TEST_ASSERT_EQUAL_STRING(s_digit_text, "00:01");
+    TEST_ASSERT_EQUAL_INT(s_frame_count, 4);
+    
+    // Test 9: Split view rebuilds both panes from the per-timer caches and
+    // only draws when a pane changed
+    s_split_view = true;
+    s_dirty |= DIRTY_NAME;
+    render_commit();
+    TEST_ASSERT_EQUAL_INT(s_frame_count, 5);
+    TEST_ASSERT_TRUE(s_split_panes[0].timer == timer1);
+    TEST_ASSERT_EQUAL_STRING(s_split_panes[0].time_text, "00:01");
+    TEST_ASSERT_EQUAL_STRING(s_split_panes[1].mode_text, "P | FB | Dev");
+    TEST_ASSERT_EQUAL_STRING(s_split_panes[1].time_text, "02:00");
+    s_dirty |= DIRTY_TIME;
+    render_commit();
+    TEST_ASSERT_EQUAL_INT(s_frame_count, 5);
+    
+    s_split_view = false;
+    reset_timer(timer1);
+    reset_timer(timer2);
+    printf("All render commit tests passed!\n");
+}
+
+// Test that the mode and name lines are only formatted when their fields change
+void test_text_cache(void) {
+    TimerState *timer1 = get_timer1();
+    TimerState *timer2 = get_timer2();
+    const int64_t start = 1800000000000LL;  // 08:00:00 UTC
+    setenv("TZ", "UTC", 1);
+    tzset();
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_mock_now_ms(start);
+    invalidate_text_cache();
+    
+    // Test 1: Steady-state ticks reuse the cached line the canvas already draws
+    s_shown_mode_text = get_mode_text(timer1);
+    TEST_ASSERT_EQUAL_STRING(s_shown_mode_text, "P | RC | Dev");
+    for (int i = 0; i < 60; i++) {
+        timer1->seconds_remaining = 60 - i;
+        get_mode_text(timer1);
+    }
+    TEST_ASSERT_NOT_NULL(s_shown_mode_text);
+    
+    // Test 2: A stage change or pause reformats the line
+    timer1->stage = STAGE_STOP;
+    TEST_ASSERT_EQUAL_STRING(get_mode_text(timer1), "P | RC | Stop");
+    TEST_ASSERT_NULL(s_shown_mode_text);
+    timer1->paused = true;
+    TEST_ASSERT_EQUAL_STRING(get_mode_text(timer1), "P | RC | Stop | PAUSED");
+    
+    // Test 3: Each timer keeps its own line, so switching back costs nothing
+    s_shown_mode_text = get_mode_text(timer1);
+    TEST_ASSERT_EQUAL_STRING(get_mode_text(timer2), "P | FB | Dev");
+    s_shown_mode_text = get_mode_text(timer1);
+    TEST_ASSERT_EQUAL_STRING(get_mode_text(timer1), "P | RC | Stop | PAUSED");
+    get_mode_text(timer2);
+    TEST_ASSERT_NOT_NULL(s_shown_mode_text);
+    
+    // Test 4: A plain timer is only named; an auto-advanced process adds the
+    // minutes left in the whole process (60 + 10 + 30 + 10 + 300 + 10 + 300 s
+    // for RC, 30 s of develop still to go)
+    TEST_ASSERT_EQUAL_STRING(get_name_text(timer1), "Timer 1");
+    reset_timer(timer1);
+    timer1->auto_advance = true;
+    timer1->draining = false;
+    build_process_schedule(timer1, 10);
+    timer1->paused = true;
+    timer1->remaining_ms = 30000;
+    TEST_ASSERT_EQUAL_STRING(get_name_text(timer1), "Timer 1 | 12m");
+    
+    // Test 5: While it runs, the clock time of the next stage change is shown,
+    // and ticks within the same minute keep the line
+    timer1->paused = false;
+    timer1->running = true;
+    timer1->deadline_ms = start + 30000;
+    s_shown_name_text = get_name_text(timer1);
+    TEST_ASSERT_EQUAL_STRING(s_shown_name_text, "Timer 1 | 12m | 08:00");
+    set_mock_now_ms(start + 1000);
+    get_name_text(timer1);
+    TEST_ASSERT_NOT_NULL(s_shown_name_text);
+    
+    timer1->auto_advance = false;
+    active_timer = 1;
+    reset_timer(timer1);
+    reset_timer(timer2);
+    printf("All text cache tests passed!\n");
+}
+
+// Test that a tick only changes the glyphs of the countdown cells that differ
+void test_digit_cells(void) {
+    bool relayout;
+    memset(s_digit_text, 0, sizeof(s_digit_text));
+    
+    // Test 1: The first text fills every cell
+    TEST_ASSERT_EQUAL_INT(set_digit_text("01:00", &relayout), 5);
+    TEST_ASSERT_TRUE(relayout);
+    
+    // Test 2: Minute rollover changes three cells, a normal second one
+    TEST_ASSERT_EQUAL_INT(set_digit_text("00:59", &relayout), 3);
+    TEST_ASSERT_FALSE(relayout);
+    TEST_ASSERT_EQUAL_INT(set_digit_text("00:58", &relayout), 1);
+    TEST_ASSERT_FALSE(relayout);
+    
+    // Test 3: An unchanged second changes nothing, so no frame is requested
+    TEST_ASSERT_EQUAL_INT(set_digit_text("00:58", &relayout), 0);
+    
+    // Test 4: Switching between minutes and seconds re-lays out the cells
+    set_digit_text("15m", &relayout);
+    TEST_ASSERT_TRUE(relayout);
+    set_digit_text("14m", &relayout);
+    TEST_ASSERT_FALSE(relayout);
+    set_digit_text("00:59", &relayout);
+    TEST_ASSERT_TRUE(relayout);
+    
+    printf("All digit cell tests passed!\n");
+}
+
+// Test that themes are resolved once and switching timers only swaps a pointer
+void test_theme_cache(void) {
+    Settings *settings = get_settings();
+    settings->invert_timer1_colors = false;
+    settings->invert_timer2_colors = false;
+    s_theme_resolves = 0;
+    resolve_display_themes();
+    
+    // Test 1: Switching timers back and forth reuses the cached themes
+    for (int i = 0; i < 10; i++) {
+        active_timer = (i % 2) + 1;
+        s_dirty = DIRTY_ALL;
+        render_commit();
+        TEST_ASSERT_TRUE(s_theme == &s_timer_themes[active_timer - 1]);
+    }
+    TEST_ASSERT_EQUAL_INT(s_theme_resolves, 1);
+    TEST_ASSERT_FALSE(s_theme->is_light_background);
+    
+    // Test 2: Ticks never touch the theme
+    s_dirty |= DIRTY_TIME;
+    render_commit();
+    TEST_ASSERT_TRUE(s_theme == &s_timer_themes[1]);
+    
+    // Test 3: An invert toggle takes effect once the themes are resolved again
+    settings->invert_timer2_colors = true;
+    TEST_ASSERT_FALSE(s_theme->is_light_background);
+    resolve_display_themes();
+    TEST_ASSERT_TRUE(s_theme->is_light_background);
+    TEST_ASSERT_EQUAL_INT(TestColorBlack, s_theme->text_color);
+    TEST_ASSERT_TRUE(s_timer_themes[0].is_light_background);
+    
+    settings->invert_timer2_colors = false;
+    resolve_display_themes();
+    active_timer = 1;
+    printf("All theme cache tests passed!\n");
+}
+
+// Split view pairing (mirrors the app): 1 and 2, 3 and 4, ... with the odd
+// timer on top; 0 means the timer is shown alone
+static int get_split_partner(int timer_number, bool split_view, int timer_count) {
+    int partner = (timer_number % 2 == 1) ? timer_number + 1 : timer_number - 1;
+    return (split_view && partner <= timer_count) ? partner : 0;
+}
+
+static int get_top_pane_timer(int active) {
+    return (active % 2 == 1) ? active : active - 1;
+}
+
+// Test which timers share the screen in split view
+void test_split_view(void) {
+    // Test 1: Off by default, every timer is shown alone
+    TEST_ASSERT_EQUAL_INT(get_split_partner(1, false, 2), 0);
+    TEST_ASSERT_EQUAL_INT(get_split_partner(2, false, 2), 0);
+    
+    // Test 2: Two trays show both timers whichever one is active
+    TEST_ASSERT_EQUAL_INT(get_split_partner(1, true, 2), 2);
+    TEST_ASSERT_EQUAL_INT(get_split_partner(2, true, 2), 1);
+    TEST_ASSERT_EQUAL_INT(get_top_pane_timer(1), 1);
+    TEST_ASSERT_EQUAL_INT(get_top_pane_timer(2), 1);
+    
+    // Test 3: Larger pools are shown in pairs
+    TEST_ASSERT_EQUAL_INT(get_split_partner(3, true, 8), 4);
+    TEST_ASSERT_EQUAL_INT(get_split_partner(8, true, 8), 7);
+    TEST_ASSERT_EQUAL_INT(get_top_pane_timer(8), 7);
+    
+    // Test 4: A timer without a partner in the pool keeps the single layout
+    TEST_ASSERT_EQUAL_INT(get_split_partner(1, true, 1), 0);
+    TEST_ASSERT_EQUAL_INT(get_split_partner(3, true, 3), 0);
+    TEST_ASSERT_EQUAL_INT(get_split_partner(2, true, 3), 1);
+    
+    printf("All split view tests passed!\n");
+}
@@ -6,6 +6,10 @@
 // Test function declarations
 void test_settings(void);
 void test_settings_persistence_integration(void);
+void test_menu_table(void);
+void test_time_editor(void);
+void test_settings_write_behind(void);
+void test_settings_record(void);
 void test_timer(void);
 void test_display(void);
 void test_color_scheme(void);
@@ -15,6 +19,19 @@ void test_mode_text_format_variations(void);
 void test_color_theme_comprehensive(void);
 void test_get_max_stage(void);
 void test_stage_scrolling(void);
+void test_deadline_engine(void);
+void test_shared_tick(void);
+void test_adaptive_resolution(void);
+void test_snapshot_restore(void);
+void test_timer_journal(void);
+void test_stage_cues(void);
+void test_process_schedule(void);
+void test_stage_progress(void);
+void test_render_commit(void);
+void test_text_cache(void);
+void test_digit_cells(void);
+void test_theme_cache(void);
+void test_split_view(void);
 
 // Test suite setup and teardown
 void suiteSetup(void) {
@@ -46,6 +63,38 @@ int main(void) {
         printf("F\n");
     }
     
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_menu_table();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_time_editor();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_settings_write_behind();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_settings_record();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
     if (setjmp(UnityGlobal.abortFrame) == 0) {
         test_timer();
     } else {
@@ -70,6 +119,110 @@ int main(void) {
         printf("F\n");
     }
     
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_deadline_engine();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_shared_tick();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_adaptive_resolution();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_snapshot_restore();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_timer_journal();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_stage_cues();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_process_schedule();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_stage_progress();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_render_commit();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_text_cache();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_digit_cells();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_theme_cache();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
+    if (setjmp(UnityGlobal.abortFrame) == 0) {
+        test_split_view();
+    } else {
+        UnityGlobal.numTests++;
+        UnityGlobal.numFails++;
+        printf("F\n");
+    }
+    
     if (setjmp(UnityGlobal.abortFrame) == 0) {
         test_display();
     } else {
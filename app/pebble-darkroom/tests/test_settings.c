@@ -272,12 +272,337 @@ void test_settings_persistence_integration(void) {
     // Verify correct persistence keys are used
     TEST_ASSERT_EQUAL_INT(SETTINGS_KEY, 1);
     TEST_ASSERT_EQUAL_INT(FILM_TIMES_KEY, 2);
-    TEST_ASSERT_EQUAL_INT(RC_PRINT_TIMES_KEY, 3);
-    TEST_ASSERT_EQUAL_INT(FIBER_PRINT_TIMES_KEY, 4);
+    TEST_ASSERT_EQUAL_INT(RC_PRINT_TIMES_KEY, 4);
+    TEST_ASSERT_EQUAL_INT(FIBER_PRINT_TIMES_KEY, 5);
+    TEST_ASSERT_EQUAL_INT(SETTINGS_RECORD_KEY, 8);
     
     printf("All settings persistence integration tests passed!\n");
 }
 
+// Table-driven settings menu (mirrors the app): rows are generated from
+// descriptors, so section sizes follow the data they edit
+typedef enum {
+    MENU_EDIT_TOGGLE,
+    MENU_EDIT_CYCLE,
+    MENU_EDIT_TIME
+} MenuEditor;
+
+typedef struct {
+    const char *label;
+    void *value;
+    MenuEditor editor;
+    uint8_t min, max, step;
+} MenuRow;
+
+static void format_menu_row(const MenuRow *row, char *buffer, size_t size) {
+    switch (row->editor) {
+        case MENU_EDIT_TOGGLE:
+            snprintf(buffer, size, "%s: %s", row->label, *(bool *)row->value ? "On" : "Off");
+            break;
+        case MENU_EDIT_CYCLE:
+            snprintf(buffer, size, "%s: %d", row->label, *(uint8_t *)row->value);
+            break;
+        case MENU_EDIT_TIME: {
+            int seconds = *(int *)row->value;
+            snprintf(buffer, size, "%s: %d:%02d", row->label, seconds / 60, seconds % 60);
+            break;
+        }
+    }
+}
+
+static void select_menu_row(const MenuRow *row) {
+    if (row->editor == MENU_EDIT_TOGGLE) {
+        *(bool *)row->value = !*(bool *)row->value;
+    } else if (row->editor == MENU_EDIT_CYCLE) {
+        uint8_t *value = row->value;
+        *value = (*value >= row->max) ? row->min : *value + row->step;
+    }
+}
+
+// Menu sections (mirrors the app's const tables). Settings the test
+// Settings struct lacks are stood in by locals with the app's defaults.
+#define MAX_TIMERS 8
+#define MAX_DRAIN_GAP_S 30
+#define DRAIN_GAP_STEP_S 5
+#define STAGE_TIME_ROW(label, value) { label, value, MENU_EDIT_TIME, 0, 0, 0 }
+
+static uint8_t s_menu_timer_count = 2;
+static bool s_auto_advance = false;
+static uint8_t s_drain_gap_s = 10;
+static bool s_split_view = false;
+
+typedef struct {
+    const char *title;
+    const MenuRow *rows;
+    uint16_t row_count;
+} MenuSection;
+
+#define ROWS(rows) rows, (uint16_t)(sizeof(rows) / sizeof(rows[0]))
+
+static const MenuSection *get_menu_sections(int *count) {
+    Settings *settings = get_settings();
+    int *film = get_film_times();
+    int *rc = get_rc_print_times();
+    int *fiber = get_fiber_print_times();
+    static MenuRow basic_rows[6];
+    static MenuRow display_rows[3];
+    static MenuRow film_rows[4];
+    static MenuRow rc_rows[4];
+    static MenuRow fiber_rows[6];
+    static MenuSection sections[5];
+    
+    const MenuRow basic[] = {
+        { "Vibration", &settings->vibration_enabled, MENU_EDIT_TOGGLE, 0, 0, 0 },
+        { "Backlight", &settings->backlight_enabled, MENU_EDIT_TOGGLE, 0, 0, 0 },
+        { "Timers", &s_menu_timer_count, MENU_EDIT_CYCLE, 1, MAX_TIMERS, 1 },
+        { "Auto-advance", &s_auto_advance, MENU_EDIT_TOGGLE, 0, 0, 0 },
+        { "Drain gap", &s_drain_gap_s, MENU_EDIT_CYCLE, 0, MAX_DRAIN_GAP_S, DRAIN_GAP_STEP_S },
+        { "Split view", &s_split_view, MENU_EDIT_TOGGLE, 0, 0, 0 }
+    };
+    const MenuRow display[] = {
+        { "Invert Timer 1", &settings->invert_timer1_colors, MENU_EDIT_TOGGLE, 0, 0, 0 },
+        { "Invert Timer 2", &settings->invert_timer2_colors, MENU_EDIT_TOGGLE, 0, 0, 0 },
+        { "Invert Menu", &settings->invert_menu_colors, MENU_EDIT_TOGGLE, 0, 0, 0 }
+    };
+    const MenuRow film_times[] = {
+        STAGE_TIME_ROW("Develop", &film[0]), STAGE_TIME_ROW("Stop", &film[1]),
+        STAGE_TIME_ROW("Fix", &film[2]), STAGE_TIME_ROW("Wash", &film[3])
+    };
+    const MenuRow rc_times[] = {
+        STAGE_TIME_ROW("Develop", &rc[0]), STAGE_TIME_ROW("Stop", &rc[1]),
+        STAGE_TIME_ROW("Fix", &rc[2]), STAGE_TIME_ROW("Wash", &rc[3])
+    };
+    const MenuRow fiber_times[] = {
+        STAGE_TIME_ROW("Develop", &fiber[0]), STAGE_TIME_ROW("Stop", &fiber[1]),
+        STAGE_TIME_ROW("Fix", &fiber[2]), STAGE_TIME_ROW("Wash", &fiber[3]),
+        STAGE_TIME_ROW("HC", &fiber[4]), STAGE_TIME_ROW("Wash2", &fiber[5])
+    };
+    memcpy(basic_rows, basic, sizeof(basic));
+    memcpy(display_rows, display, sizeof(display));
+    memcpy(film_rows, film_times, sizeof(film_times));
+    memcpy(rc_rows, rc_times, sizeof(rc_times));
+    memcpy(fiber_rows, fiber_times, sizeof(fiber_times));
+    
+    sections[0] = (MenuSection){ "Basic Settings", ROWS(basic_rows) };
+    sections[1] = (MenuSection){ "Display Settings", ROWS(display_rows) };
+    sections[2] = (MenuSection){ "Film Times", ROWS(film_rows) };
+    sections[3] = (MenuSection){ "RC Print Times", ROWS(rc_rows) };
+    sections[4] = (MenuSection){ "Fiber Print Times", ROWS(fiber_rows) };
+    *count = 5;
+    return sections;
+}
+
+// menu_get_num_rows_callback and get_menu_row in the app
+static uint16_t get_menu_num_rows(const MenuSection *sections, int section) {
+    return sections[section].row_count;
+}
+
+static const MenuRow *get_menu_row(const MenuSection *sections, int section, int row) {
+    return &sections[section].rows[row];
+}
+
+void test_menu_table(void) {
+    int section_count;
+    const MenuSection *sections = get_menu_sections(&section_count);
+    Settings *settings = get_settings();
+    int *fiber = get_fiber_print_times();
+    int *rc = get_rc_print_times();
+    char buffer[32];
+    
+    // Test 1: Each section has a row for every value it edits
+    TEST_ASSERT_EQUAL_INT(section_count, 5);
+    TEST_ASSERT_EQUAL_INT(get_menu_num_rows(sections, 0), 6);
+    TEST_ASSERT_EQUAL_INT(get_menu_num_rows(sections, 1), 3);
+    TEST_ASSERT_EQUAL_INT(get_menu_num_rows(sections, 2), 4);
+    TEST_ASSERT_EQUAL_INT(get_menu_num_rows(sections, 3), 4);
+    
+    // Test 2: The fiber section reaches Wash2, which the old hard-coded
+    // count of five rows hid
+    TEST_ASSERT_EQUAL_INT(get_menu_num_rows(sections, 4), 6);
+    const MenuRow *wash2 = get_menu_row(sections, 4, 5);
+    TEST_ASSERT_TRUE(wash2->value == &fiber[STAGE_WASH2]);
+    format_menu_row(wash2, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING(buffer, "Wash2: 15:00");
+    
+    // Test 3: Select indexes resolve to the rows and values they show
+    TEST_ASSERT_TRUE(get_menu_row(sections, 0, 0)->value == &settings->vibration_enabled);
+    TEST_ASSERT_TRUE(get_menu_row(sections, 0, 2)->value == &s_menu_timer_count);
+    TEST_ASSERT_TRUE(get_menu_row(sections, 1, 2)->value == &settings->invert_menu_colors);
+    TEST_ASSERT_TRUE(get_menu_row(sections, 3, 1)->value == &rc[STAGE_STOP]);
+    TEST_ASSERT_TRUE(get_menu_row(sections, 4, 4)->value == &fiber[STAGE_HYPO_CLEAR]);
+    TEST_ASSERT_EQUAL_STRING(get_menu_row(sections, 4, 4)->label, "HC");
+    
+    // Test 4: A toggle row flips its value and reformats from it
+    const MenuRow *vibration = get_menu_row(sections, 0, 0);
+    select_menu_row(vibration);
+    format_menu_row(vibration, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING(buffer, "Vibration: Off");
+    select_menu_row(vibration);
+    TEST_ASSERT_TRUE(settings->vibration_enabled);
+    
+    // Test 5: Cycle rows step up to their maximum and wrap to the minimum
+    const MenuRow *timers = get_menu_row(sections, 0, 2);
+    s_menu_timer_count = 7;
+    select_menu_row(timers);
+    TEST_ASSERT_EQUAL_INT(s_menu_timer_count, 8);
+    select_menu_row(timers);
+    TEST_ASSERT_EQUAL_INT(s_menu_timer_count, 1);
+    s_drain_gap_s = 25;
+    select_menu_row(get_menu_row(sections, 0, 4));
+    select_menu_row(get_menu_row(sections, 0, 4));
+    TEST_ASSERT_EQUAL_INT(s_drain_gap_s, 0);
+    
+    // Test 6: Selecting a time row leaves the value to its editor
+    select_menu_row(get_menu_row(sections, 4, 0));
+    TEST_ASSERT_EQUAL_INT(fiber[0], 120);
+    
+    s_menu_timer_count = 2;
+    s_drain_gap_s = 10;
+    printf("All menu table tests passed!\n");
+}
+
+void test_settings_write_behind(void) {
+    set_mock_now_ms(1000000);
+    clear_settings_writes();
+    persist_write_called = false;
+    
+    // Test 1: An edit only marks the settings; the write waits for a flush
+    mark_settings_dirty();
+    TEST_ASSERT_EQUAL_INT(get_settings_writes(), 0);
+    TEST_ASSERT_FALSE(persist_write_called);
+    flush_settings();
+    TEST_ASSERT_EQUAL_INT(get_settings_writes(), 1);
+    TEST_ASSERT_EQUAL_INT(persist_key, SETTINGS_RECORD_KEY);
+    TEST_ASSERT_EQUAL_INT(persist_size, (int)sizeof(SettingsRecord));
+    TEST_ASSERT_FALSE(is_settings_flush_timer_armed());
+    
+    // Test 2: Flushing with nothing changed writes nothing
+    flush_settings();
+    TEST_ASSERT_EQUAL_INT(get_settings_writes(), 1);
+    
+    // Test 3: Two edits to the same object before a flush cost one write
+    mark_settings_dirty();
+    mark_settings_dirty();
+    flush_settings();
+    TEST_ASSERT_EQUAL_INT(get_settings_writes(), 2);
+    
+    // Test 4: The idle timer flushes 10 s after the last edit, not the first
+    mark_settings_dirty();
+    set_mock_now_ms(1000000 + 6000);
+    mark_settings_dirty();
+    set_mock_now_ms(1000000 + 6000 + SETTINGS_FLUSH_IDLE_MS - 1);
+    TEST_ASSERT_FALSE(service_settings_flush_timer());
+    TEST_ASSERT_EQUAL_INT(get_settings_writes(), 2);
+    set_mock_now_ms(1000000 + 6000 + SETTINGS_FLUSH_IDLE_MS);
+    TEST_ASSERT_TRUE(service_settings_flush_timer());
+    TEST_ASSERT_EQUAL_INT(get_settings_writes(), 3);
+    TEST_ASSERT_FALSE(service_settings_flush_timer());
+    
+    // Test 5: Closing the menu flushes at once and disarms the idle timer
+    mark_settings_dirty();
+    settings_menu_closed();
+    TEST_ASSERT_EQUAL_INT(get_settings_writes(), 4);
+    TEST_ASSERT_FALSE(is_settings_flush_timer_armed());
+    
+    // Test 6: Losing focus flushes; regaining it does not
+    mark_settings_dirty();
+    settings_focus_changed(true);
+    TEST_ASSERT_EQUAL_INT(get_settings_writes(), 4);
+    settings_focus_changed(false);
+    TEST_ASSERT_EQUAL_INT(get_settings_writes(), 5);
+    
+    printf("All settings write-behind tests passed!\n");
+}
+
+void test_settings_record(void) {
+    Settings *settings = get_settings();
+    int *fiber = get_fiber_print_times();
+    SettingsRecord record;
+    
+    // Test 1: The record packs without padding into 36 bytes
+    TEST_ASSERT_EQUAL_INT((int)sizeof(SettingsRecord), 36);
+    
+    // Test 2: A packed record restores flags and stage times
+    settings->invert_menu_colors = true;
+    fiber[5] = 1200;
+    pack_settings(&record);
+    TEST_ASSERT_EQUAL_INT(record.version, SETTINGS_RECORD_VERSION);
+    settings->invert_menu_colors = false;
+    fiber[5] = 900;
+    TEST_ASSERT_TRUE(unpack_settings(&record, sizeof(record)));
+    TEST_ASSERT_TRUE(settings->invert_menu_colors);
+    TEST_ASSERT_TRUE(settings->vibration_enabled);
+    TEST_ASSERT_EQUAL_INT(fiber[5], 1200);
+    
+    // Test 3: A corrupted record is rejected and leaves the settings alone
+    fiber[5] = 900;
+    pack_settings(&record);
+    record.fiber_print_times[0] ^= 0x40;
+    TEST_ASSERT_FALSE(unpack_settings(&record, sizeof(record)));
+    TEST_ASSERT_EQUAL_INT(fiber[0], 120);
+    
+    // Test 4: Truncated and unknown-version records are rejected
+    pack_settings(&record);
+    TEST_ASSERT_FALSE(unpack_settings(&record, sizeof(record) - 4));
+    record.version = SETTINGS_RECORD_VERSION + 1;
+    TEST_ASSERT_FALSE(unpack_settings(&record, sizeof(record)));
+    
+    settings->invert_menu_colors = false;
+    printf("All settings record tests passed!\n");
+}
+
+// Stage time editor stepping (mirrors the app): held buttons speed up,
+// accelerated second steps snap to the step and carry into minutes
+#define TIME_EDITOR_MAX_S (99 * 60 + 59)
+
+static int get_time_editor_step(int repeats) {
+    return repeats < 8 ? 1 : (repeats < 20 ? 5 : 10);
+}
+
+static int adjust_time_editor(int value, bool editing_seconds, int direction, int repeats) {
+    int step = get_time_editor_step(repeats);
+    
+    if (editing_seconds) {
+        value = (value / step) * step + (direction > 0 || value % step == 0 ? direction * step : 0);
+    } else {
+        value += direction * step * 60;
+    }
+    if (value < 1) {
+        value = 1;
+    } else if (value > TIME_EDITOR_MAX_S) {
+        value = TIME_EDITOR_MAX_S;
+    }
+    return value;
+}
+
+void test_time_editor(void) {
+    // Test 1: Single presses move one unit of the selected field
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(90, true, 1, 1), 91);
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(90, false, -1, 1), 30);
+    
+    // Test 2: Holding a button steps by 5, then by 10
+    TEST_ASSERT_EQUAL_INT(get_time_editor_step(0), 1);
+    TEST_ASSERT_EQUAL_INT(get_time_editor_step(8), 5);
+    TEST_ASSERT_EQUAL_INT(get_time_editor_step(20), 10);
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(300, false, 1, 20), 900);
+    
+    // Test 3: Accelerated second steps land on multiples of the step
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(23, true, 1, 8), 25);
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(23, true, -1, 8), 20);
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(20, true, -1, 8), 15);
+    
+    // Test 4: Seconds carry into minutes
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(59, true, 1, 0), 60);
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(115, true, 1, 25), 120);
+    
+    // Test 5: Values stay between 0:01 and 99:59
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(30, false, -1, 0), 1);
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(5, true, -1, 20), 1);
+    TEST_ASSERT_EQUAL_INT(adjust_time_editor(TIME_EDITOR_MAX_S - 30, false, 1, 0), TIME_EDITOR_MAX_S);
+    
+    printf("All time editor tests passed!\n");
+}
+
 // setUp and tearDown for individual tests
 void setUp(void) {
     // Reset mock flags before each test
@@ -601,3 +601,589 @@ void test_stage_scrolling(void) {
     
     printf("All stage scrolling tests passed!\n");
 }
+
+// Test group for the deadline-based countdown engine
+void test_deadline_engine(void) {
+    TimerState *timer1 = get_timer1();
+    TimerState *timer2 = get_timer2();
+    const int64_t start = 1700000000000LL;
+    
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_scheduler_active_timer(1);
+    
+    // Test 1: A 900 s wash ends within the tick latency of its planned end,
+    // even when every tick is delivered late. Wash is RC's last stage, so
+    // the process ends with nothing left to remind about.
+    timer1->stage = STAGE_WASH;
+    set_timer_duration(timer1, 900);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    TEST_ASSERT_TRUE(timer1->deadline_ms == start + 900000);
+    
+    int64_t now = start;
+    int ticks = 0;
+    while (timer1->running && ticks < 2000) {
+        now += get_armed_tick_delay() + 37;  // Simulated event loop latency
+        set_mock_now_ms(now);
+        scheduler_tick();
+        ticks++;
+        if (timer1->running) {
+            // Displayed seconds never run ahead of the real remaining time
+            TEST_ASSERT_TRUE((int64_t)timer1->seconds_remaining * 1000 >= start + 900000 - now);
+        }
+    }
+    TEST_ASSERT_FALSE(timer1->running);
+    TEST_ASSERT_TRUE(now >= start + 900000);
+    TEST_ASSERT_TRUE(now - (start + 900000) <= 37);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 0);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 0);  // Nothing left to service
+    
+    // Test 2: Ticks land on second boundaries of the remaining time
+    TEST_ASSERT_EQUAL_INT(get_tick_delay(60000), 1000);
+    TEST_ASSERT_EQUAL_INT(get_tick_delay(59600), 600);
+    TEST_ASSERT_EQUAL_INT(get_tick_delay(250), 250);
+    
+    // Test 3: Pause banks the elapsed time and resume re-arms from it
+    set_timer_duration(timer1, 60);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    set_mock_now_ms(start + 10400);
+    timer1->timer_handle = NULL;
+    pause_timer(timer1);
+    TEST_ASSERT_TRUE(timer1->paused);
+    TEST_ASSERT_EQUAL_INT(timer1->remaining_ms, 49600);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 50);
+    
+    set_mock_now_ms(start + 500000);  // Time spent paused is not counted
+    resume_timer(timer1);
+    TEST_ASSERT_TRUE(timer1->running);
+    TEST_ASSERT_TRUE(timer1->deadline_ms == start + 500000 + 49600);
+    TEST_ASSERT_EQUAL_INT(get_remaining_ms(timer1, start + 500000), 49600);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 600);
+    
+    // Test 4: A tick delivered late by a stalled event loop does not
+    // stretch the stage: the deadline stays put and the stage ends on time
+    set_timer_duration(timer1, 300);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    now = start + get_armed_tick_delay();
+    set_mock_now_ms(now);
+    scheduler_tick();
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 240);
+    int64_t stage_end = timer1->deadline_ms;
+    now += get_armed_tick_delay() + 30000;  // Delivered 30 s late
+    set_mock_now_ms(now);
+    scheduler_tick();
+    TEST_ASSERT_TRUE(timer1->deadline_ms == stage_end);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 150);
+    now = stage_end + 5000;                 // Stalled past the end
+    set_mock_now_ms(now);
+    scheduler_tick();
+    TEST_ASSERT_FALSE(timer1->running);
+    
+    // Test 5: A backward wall-clock jump is absorbed and journaled
+    set_timer_duration(timer1, 300);
+    start_timer(timer1);
+    now += get_armed_tick_delay();
+    set_mock_now_ms(now);
+    scheduler_tick();
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 240);
+    clear_journal();
+    now += (int64_t)get_armed_tick_delay() - 120000;  // Clock moved back two minutes
+    set_mock_now_ms(now);
+    scheduler_tick();
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 180);
+    TimerJournal journal;
+    TEST_ASSERT_TRUE(load_timer_journal(&journal));
+    TEST_ASSERT_TRUE(journal.timers[0].deadline_ms == timer1->deadline_ms);
+    
+    // Test 6: Small scheduling jitter is not mistaken for a clock jump
+    int64_t deadline = timer1->deadline_ms;
+    now += get_armed_tick_delay() + 150;
+    set_mock_now_ms(now);
+    scheduler_tick();
+    TEST_ASSERT_TRUE(timer1->deadline_ms == deadline);
+    
+    reset_timer(timer1);
+    timer1->timer_handle = NULL;
+    
+    printf("All deadline engine tests passed!\n");
+}
+
+// Test group for the single shared tick serving both timers
+void test_shared_tick(void) {
+    TimerState *timer1 = get_timer1();
+    TimerState *timer2 = get_timer2();
+    const int64_t start = 1700000000000LL;
+    
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_scheduler_active_timer(1);
+    
+    // Test 1: Two timers at unaligned phases share one wakeup per second
+    set_timer_duration(timer1, 1800);
+    set_timer_duration(timer2, 1800);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    set_mock_now_ms(start + 430);
+    start_timer(timer2);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 59570);  // Still on timer 1's minute
+    
+    // Test 2: Count wakeups over a simulated hour of dual-tray processing
+    uint32_t ticks_before = get_tick_count();
+    int64_t now = start + 430;
+    while ((timer1->running || timer2->running) && now < start + 3600000) {
+        now += get_armed_tick_delay();
+        set_mock_now_ms(now);
+        scheduler_tick();
+    }
+    uint32_t wakeups = get_tick_count() - ticks_before;
+    printf("Shared tick wakeups for two 30 min stages: %u (two chains: ~3600)\n",
+           (unsigned)wakeups);
+    
+    // 29 minute ticks and 60 final-minute ticks for displayed timer 1,
+    // plus hidden timer 2's pre-end warning and deadline
+    TEST_ASSERT_FALSE(timer1->running);
+    TEST_ASSERT_FALSE(timer2->running);
+    TEST_ASSERT_EQUAL_INT(wakeups, 29 + 60 + 2);
+    
+    // Test 3: Timer 2's stage still ended exactly on its deadline
+    TEST_ASSERT_TRUE(now == start + 430 + 1800000);
+    
+    // Test 4: Switching the displayed timer re-phases the tick
+    set_timer_duration(timer1, 60);
+    set_timer_duration(timer2, 60);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    set_mock_now_ms(start + 250);
+    start_timer(timer2);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 750);
+    set_scheduler_active_timer(2);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 1000);
+    set_scheduler_active_timer(1);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 750);
+    
+    // Test 5: A background timer only wakes the scheduler for its pre-end
+    // warning and its deadline
+    reset_timer(timer1);
+    TEST_ASSERT_EQUAL_INT(get_heap_size(), 1);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 60000 - PRE_END_WARNING_MS);
+    uint32_t ticks_hidden = get_tick_count();
+    set_mock_now_ms(start + 250 + 60000 - PRE_END_WARNING_MS);
+    scheduler_tick();
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), PRE_END_WARNING_MS);
+    set_mock_now_ms(start + 250 + 60000);
+    scheduler_tick();
+    TEST_ASSERT_EQUAL_INT(get_tick_count() - ticks_hidden, 2);
+    TEST_ASSERT_EQUAL_INT(get_last_tick_serviced(), 1);
+    TEST_ASSERT_FALSE(timer2->running);
+    
+    // The completed stage stays on the heap only for its reminder
+    TEST_ASSERT_EQUAL_INT(timer2->cue_kind, CUE_REMINDER);
+    TEST_ASSERT_EQUAL_INT(get_heap_size(), 1);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), STAGE_REMINDER_MS);
+    reset_timer(timer2);
+    TEST_ASSERT_EQUAL_INT(get_heap_size(), 0);
+    
+    // Test 6: Each wakeup services only the timers whose event is due
+    set_timer_duration(timer1, 60);
+    set_timer_duration(timer2, 600);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    start_timer(timer2);
+    TEST_ASSERT_EQUAL_INT(get_heap_size(), 2);
+    set_mock_now_ms(start + 1000);
+    scheduler_tick();
+    TEST_ASSERT_EQUAL_INT(get_last_tick_serviced(), 1);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 59);
+    
+    // Test 7: Pausing takes a timer out of the queue
+    pause_timer(timer1);
+    TEST_ASSERT_EQUAL_INT(get_heap_size(), 1);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 599000 - PRE_END_WARNING_MS);  // Timer 2's warning
+    
+    reset_timer(timer1);
+    reset_timer(timer2);
+    
+    printf("All shared tick and event heap tests passed!\n");
+}
+
+// Test group for minute granularity until the final minute of a stage
+void test_adaptive_resolution(void) {
+    TimerState *timer1 = get_timer1();
+    TimerState *timer2 = get_timer2();
+    const int64_t start = 1800000000000LL;
+    char buffer[8];
+    
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_scheduler_active_timer(1);
+    
+    // Test 1: A 900 s wash wakes once a minute until its final minute
+    set_timer_duration(timer1, 900);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    format_countdown(buffer, sizeof(buffer), timer1, start);
+    TEST_ASSERT_EQUAL_STRING("15m", buffer);
+    
+    uint32_t ticks_before = get_tick_count();
+    int64_t now = start;
+    bool hit_final_minute = false;
+    while (timer1->running) {
+        now += get_armed_tick_delay();
+        set_mock_now_ms(now);
+        scheduler_tick();
+        hit_final_minute |= (now == start + 900000 - FINAL_MINUTE_MS);
+    }
+    uint32_t wakeups = get_tick_count() - ticks_before;
+    printf("Wakeups for a 900 s wash: %u (per-second: 900)\n", (unsigned)wakeups);
+    TEST_ASSERT_EQUAL_INT(wakeups, 14 + 60);
+    
+    // Test 2: The switch to seconds and the stage end land exactly on time
+    TEST_ASSERT_TRUE(hit_final_minute);
+    TEST_ASSERT_TRUE(now == start + 900000);
+    
+    // Test 3: Minutes are rounded up, seconds take over in the final minute
+    set_timer_duration(timer1, 300);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    now = start + 59500;
+    timer1->seconds_remaining = 241;
+    format_countdown(buffer, sizeof(buffer), timer1, now);
+    TEST_ASSERT_EQUAL_STRING("5m", buffer);
+    timer1->seconds_remaining = 60;
+    format_countdown(buffer, sizeof(buffer), timer1, now);
+    TEST_ASSERT_EQUAL_STRING("01:00", buffer);
+    timer1->seconds_remaining = 300;
+    
+    // Test 4: A button press switches to per-second updates for a while
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 60000);
+    set_mock_now_ms(start + 30000);
+    note_interaction(start + 30000);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 1000);
+    format_countdown(buffer, sizeof(buffer), timer1, start + 30000);
+    TEST_ASSERT_EQUAL_STRING("04:30", buffer);
+    
+    // Test 5: Once the window passes, the next tick drops back to minutes
+    now = start + 30000;
+    for (int i = 0; i < INTERACTION_WINDOW_MS / 1000; i++) {
+        now += get_armed_tick_delay();
+        set_mock_now_ms(now);
+        scheduler_tick();
+    }
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), 25000);
+    format_countdown(buffer, sizeof(buffer), timer1, now);
+    TEST_ASSERT_EQUAL_STRING("5m", buffer);
+    
+    // Test 6: Stopped timers always show exact minutes and seconds
+    reset_timer(timer1);
+    set_timer_duration(timer1, 900);
+    format_countdown(buffer, sizeof(buffer), timer1, now);
+    TEST_ASSERT_EQUAL_STRING("15:00", buffer);
+    
+    printf("All adaptive resolution tests passed!\n");
+}
+
+// Test restoring from the journal with elapsed-time catch-up
+void test_snapshot_restore(void) {
+    TimerState *timer1 = get_timer1();
+    TimerState *timer2 = get_timer2();
+    const int64_t start = 1800000000000LL;
+    
+    clear_journal();
+    clear_cues_fired();
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_mock_now_ms(start);
+    
+    // Timer 1 is mid-fix, timer 2 is paused part way through its develop
+    timer1->stage = STAGE_FIX;
+    set_timer_duration(timer1, 300);
+    start_timer(timer1);
+    set_timer_duration(timer2, 120);
+    start_timer(timer2);
+    set_mock_now_ms(start + 45500);
+    pause_timer(timer2);
+    journal_write();
+    
+    // Test 1: Relaunching 100 s later shows the caught-up time, not the stage default
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_mock_now_ms(start + 100000);
+    restore_timer_state(true);
+    TEST_ASSERT_TRUE(timer1->running);
+    TEST_ASSERT_EQUAL_INT(timer1->stage, STAGE_FIX);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 200);
+    
+    // Test 2: A paused timer keeps its banked time regardless of elapsed time
+    TEST_ASSERT_TRUE(timer2->paused);
+    TEST_ASSERT_FALSE(timer2->running);
+    TEST_ASSERT_EQUAL_INT(timer2->remaining_ms, 74500);
+    TEST_ASSERT_EQUAL_INT(timer2->seconds_remaining, 75);
+    
+    // Test 3: While a worker's records are pending the journal is only shown:
+    // a stage that finished stays on screen, unscheduled, for the worker
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_mock_now_ms(start + 400000);
+    restore_timer_state(false);
+    TEST_ASSERT_TRUE(timer1->running);
+    TEST_ASSERT_EQUAL_INT(timer1->stage, STAGE_FIX);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 0);
+    TEST_ASSERT_TRUE(timer2->paused);
+    TEST_ASSERT_EQUAL_INT(timer2->seconds_remaining, 75);
+    TEST_ASSERT_EQUAL_INT(get_heap_size(), 0);
+    
+    // Test 4: Resuming completes it, loads the next stage and leaves its
+    // reminder on the heap until the next stage is started
+    restore_timer_state(true);
+    TEST_ASSERT_FALSE(timer1->running);
+    TEST_ASSERT_EQUAL_INT(timer1->stage, STAGE_WASH);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 300);
+    TEST_ASSERT_EQUAL_INT(timer1->cue_kind, CUE_REMINDER);
+    TEST_ASSERT_EQUAL_INT(get_heap_size(), 1);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), STAGE_REMINDER_MS);
+    
+    set_mock_now_ms(start + 400000 + STAGE_REMINDER_MS);
+    scheduler_tick();
+    TEST_ASSERT_EQUAL_INT(get_cues_fired(CUE_REMINDER), 1);
+    TEST_ASSERT_EQUAL_INT(get_heap_size(), 0);
+    
+    // Test 5: An auto-advanced process walks every transition it missed.
+    // RC develop ends at 60 s, the 10 s drain gap at 70 s, stop at 100 s.
+    clear_journal();
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_mock_now_ms(start);
+    timer1->auto_advance = true;
+    build_process_schedule(timer1, 10);
+    start_timer(timer1);
+    journal_write();
+    
+    reset_timer(timer1);
+    timer1->auto_advance = false;
+    set_mock_now_ms(start + 75000);
+    restore_timer_state(true);
+    TEST_ASSERT_TRUE(timer1->running);
+    TEST_ASSERT_TRUE(timer1->auto_advance);
+    TEST_ASSERT_FALSE(timer1->draining);
+    TEST_ASSERT_EQUAL_INT(timer1->stage, STAGE_STOP);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 25);
+    
+    // Test 6: A stage time edited while the timer is idle survives a relaunch
+    timer1->auto_advance = false;
+    clear_journal();
+    reset_timer(timer1);
+    journal_write();
+    commit_time_edit(&get_rc_print_times()[STAGE_DEVELOP], 90);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 90);
+    set_timer_duration(timer1, 0);
+    restore_timer_state(true);
+    TEST_ASSERT_FALSE(timer1->running);
+    TEST_ASSERT_EQUAL_INT(timer1->stage, STAGE_DEVELOP);
+    TEST_ASSERT_EQUAL_INT(timer1->remaining_ms, 90000);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 90);
+    
+    get_rc_print_times()[STAGE_DEVELOP] = 60;
+    flush_settings();
+    clear_settings_writes();
+    clear_journal();
+    clear_cues_fired();
+    reset_timer(timer1);
+    reset_timer(timer2);
+    printf("All snapshot restore tests passed!\n");
+}
+
+// Test crash-safe A/B journal recovery
+void test_timer_journal(void) {
+    TimerState *timer1 = get_timer1();
+    TimerState *timer2 = get_timer2();
+    const int64_t start = 1800000000000LL;
+    TimerJournal journal;
+    
+    clear_journal();
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_mock_now_ms(start);
+    
+    // Test 1: Nothing journaled yet means nothing to recover
+    TEST_ASSERT_FALSE(load_timer_journal(&journal));
+    
+    // Test 2: Transitions alternate slots and recovery picks the newest
+    set_timer_duration(timer1, 300);
+    start_timer(timer1);
+    journal_write();
+    set_mock_now_ms(start + 10000);
+    pause_timer(timer1);
+    journal_write();
+    TEST_ASSERT_EQUAL_INT(get_journal_slot(1)->sequence, 1);
+    TEST_ASSERT_EQUAL_INT(get_journal_slot(0)->sequence, 2);
+    TEST_ASSERT_TRUE(load_timer_journal(&journal));
+    TEST_ASSERT_EQUAL_INT(journal.sequence, 2);
+    TEST_ASSERT_TRUE(journal.timers[0].paused);
+    TEST_ASSERT_EQUAL_INT(journal.timers[0].remaining_ms, 290000);
+    
+    // Test 3: A torn write in the newest slot falls back to the previous record
+    get_journal_slot(0)->timers[0].remaining_ms = 12345;
+    TEST_ASSERT_TRUE(load_timer_journal(&journal));
+    TEST_ASSERT_EQUAL_INT(journal.sequence, 1);
+    TEST_ASSERT_TRUE(journal.timers[0].running);
+    TEST_ASSERT_EQUAL_INT((int)(journal.timers[0].deadline_ms - start), 300000);
+    
+    // Test 4: Both slots corrupt means a clean start
+    get_journal_slot(1)->sequence ^= 0x100;
+    TEST_ASSERT_FALSE(load_timer_journal(&journal));
+    
+    clear_journal();
+    reset_timer(timer1);
+    reset_timer(timer2);
+    printf("All timer journal tests passed!\n");
+}
+
+// Test agitation and pre-end warning cues riding the shared tick
+void test_stage_cues(void) {
+    TimerState *timer1 = get_timer1();
+    TimerState *timer2 = get_timer2();
+    const int64_t start = 1800000000000LL;
+    
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_scheduler_active_timer(2);
+    clear_cues_fired();
+    
+    // Test 1: A 300 s film develop agitates every 30 s and warns 10 s before the end
+    timer1->mode = MODE_FILM;
+    reset_timer(timer1);
+    TEST_ASSERT_EQUAL_INT(timer1->seconds_remaining, 300);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    TEST_ASSERT_EQUAL_INT(timer1->cue_kind, CUE_AGITATE);
+    TEST_ASSERT_EQUAL_INT(get_armed_tick_delay(), AGITATION_INTERVAL_MS);
+    
+    uint32_t ticks_before = get_tick_count();
+    int64_t now = start;
+    while (timer1->running) {
+        now += get_armed_tick_delay();
+        set_mock_now_ms(now);
+        scheduler_tick();
+    }
+    TEST_ASSERT_EQUAL_INT(get_cues_fired(CUE_AGITATE), 9);
+    TEST_ASSERT_EQUAL_INT(get_cues_fired(CUE_WARNING), 1);
+    // One wakeup per cue plus the deadline: no separate timer chains
+    TEST_ASSERT_EQUAL_INT(get_tick_count() - ticks_before, 11);
+    TEST_ASSERT_EQUAL_INT((int)(now - start), 300000);
+    
+    // Test 2: Pausing drops the pending cue; resuming replans it on the new deadline
+    clear_cues_fired();
+    reset_timer(timer1);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    set_mock_now_ms(start + 45000);
+    pause_timer(timer1);
+    TEST_ASSERT_EQUAL_INT(timer1->cue_kind, CUE_NONE);
+    TEST_ASSERT_EQUAL_INT(get_heap_size(), 0);
+    set_mock_now_ms(start + 100000);
+    resume_timer(timer1);
+    TEST_ASSERT_EQUAL_INT(timer1->cue_kind, CUE_AGITATE);
+    TEST_ASSERT_EQUAL_INT((int)(timer1->cue_ms - (start + 100000)), 15000);
+    
+    // Test 3: Print stages only get the pre-end warning
+    timer1->mode = MODE_PRINT;
+    reset_timer(timer1);
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    TEST_ASSERT_EQUAL_INT(timer1->cue_kind, CUE_WARNING);
+    TEST_ASSERT_EQUAL_INT((int)(timer1->cue_ms - start), 50000);
+    
+    reset_timer(timer1);
+    reset_timer(timer2);
+    set_scheduler_active_timer(1);
+    printf("All stage cue tests passed!\n");
+}
+
+// Test the precomputed auto-advance schedule
+void test_process_schedule(void) {
+    TimerState *timer1 = get_timer1();
+    TimerState *timer2 = get_timer2();
+    const int64_t start = 1800000000000LL;
+    
+    reset_timer(timer1);
+    reset_timer(timer2);
+    
+    // Test 1: RC stages 60/30/300/300 with a 10 s drain gap before each later stage
+    build_process_schedule(timer1, 10);
+    TEST_ASSERT_EQUAL_INT(timer1->stage_end_s[0], 60);
+    TEST_ASSERT_EQUAL_INT(timer1->stage_end_s[1], 100);
+    TEST_ASSERT_EQUAL_INT(timer1->stage_end_s[2], 410);
+    TEST_ASSERT_EQUAL_INT(timer1->stage_end_s[3], 720);
+    
+    // Test 2: Whole-process time left at the start of Develop
+    TEST_ASSERT_EQUAL_INT(get_process_remaining_ms(timer1, start), 720000);
+    
+    // Test 3: Part way through Develop, from the running deadline
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    TEST_ASSERT_EQUAL_INT(get_process_remaining_ms(timer1, start + 25000), 695000);
+    
+    // Test 4: During the drain gap before Fix, 4 s into the gap
+    timer1->stage = STAGE_FIX;
+    timer1->draining = true;
+    timer1->deadline_ms = start + 6000;
+    TEST_ASSERT_EQUAL_INT(get_process_remaining_ms(timer1, start), 6000 + 610000);
+    
+    // Test 5: Paused in the final stage only the banked time is left
+    timer1->draining = false;
+    timer1->stage = STAGE_WASH;
+    pause_timer(timer1);
+    timer1->remaining_ms = 42000;
+    TEST_ASSERT_EQUAL_INT(get_process_remaining_ms(timer1, start + 999999), 42000);
+    
+    // Test 6: Fiber's six stages without a gap add up to the timing array
+    build_process_schedule(timer2, 0);
+    timer2->stage = STAGE_DEVELOP;
+    TEST_ASSERT_EQUAL_INT(timer2->stage_end_s[5], 120 + 30 + 120 + 300 + 120 + 900);
+    TEST_ASSERT_EQUAL_INT(get_process_remaining_ms(timer2, start), 1590000);
+    
+    reset_timer(timer1);
+    reset_timer(timer2);
+    printf("All process schedule tests passed!\n");
+}
+
+// Test that the current stage's indicator fills with elapsed time
+void test_stage_progress(void) {
+    TimerState *timer1 = get_timer1();
+    const int64_t start = 1800000000000LL;
+    const int bar_width = 29;   // One of four RC bars on a 124 px strip
+    
+    reset_timer(timer1);
+    
+    // Test 1: Nothing is filled before the stage starts
+    TEST_ASSERT_EQUAL_INT(get_stage_progress(timer1, start, bar_width), 0);
+    
+    // Test 2: Develop (60 s) fills one column roughly every two seconds
+    set_mock_now_ms(start);
+    start_timer(timer1);
+    TEST_ASSERT_EQUAL_INT(get_stage_progress(timer1, start + 1000, bar_width), 0);
+    TEST_ASSERT_EQUAL_INT(get_stage_progress(timer1, start + 30000, bar_width), 14);
+    TEST_ASSERT_EQUAL_INT(get_stage_progress(timer1, start + 31000, bar_width), 14);
+    TEST_ASSERT_EQUAL_INT(get_stage_progress(timer1, start + 32000, bar_width), 15);
+    
+    // Test 3: At the deadline the bar is full
+    TEST_ASSERT_EQUAL_INT(get_stage_progress(timer1, start + 60000, bar_width), bar_width);
+    
+    // Test 4: A paused stage keeps its fill
+    set_mock_now_ms(start + 45000);
+    pause_timer(timer1);
+    TEST_ASSERT_EQUAL_INT(get_stage_progress(timer1, start + 300000, bar_width), 21);
+    
+    // Test 5: The ring on round screens uses degrees of the stage's arc
+    TEST_ASSERT_EQUAL_INT(get_stage_progress(timer1, start, 86), 64);
+    
+    // Test 6: Nothing of the next stage has elapsed during a drain gap
+    timer1->draining = true;
+    TEST_ASSERT_EQUAL_INT(get_stage_progress(timer1, start, bar_width), 0);
+    
+    reset_timer(timer1);
+    printf("All stage progress tests passed!\n");
+}
@@ -0,0 +1,151 @@
+#include <pebble_worker.h>
+#include "../../src/c/darkroom_worker.h"
+
+// Background worker: holds the timer records handed over by the app when it
+// closes, and relaunches the app as soon as a running stage completes so the
+// app can vibrate and advance to the next stage.
+
+typedef struct {
+    bool present;
+    uint16_t flags;
+    int64_t deadline_ms;    // While running
+    int32_t remaining_ms;   // While paused or stopped
+} WorkerTimer;
+
+static WorkerTimer s_timers[WORKER_MAX_TIMERS];
+static bool s_detached = false;
+static AppTimer *s_deadline_timer = NULL;
+
+static int64_t now_ms() {
+    time_t seconds;
+    uint16_t milliseconds;
+    time_ms(&seconds, &milliseconds);
+    return (int64_t)seconds * 1000 + milliseconds;
+}
+
+static void deadline_callback(void *data);
+
+// Arm a single timer for the earliest running deadline
+static void arm_deadline_timer() {
+    if (s_deadline_timer) {
+        app_timer_cancel(s_deadline_timer);
+        s_deadline_timer = NULL;
+    }
+    if (!s_detached) {
+        return;
+    }
+
+    int64_t earliest = 0;
+    bool found = false;
+    for (int i = 0; i < WORKER_MAX_TIMERS; i++) {
+        WorkerTimer *timer = &s_timers[i];
+        if (timer->present && (timer->flags & WORKER_RECORD_RUNNING) &&
+            (!found || timer->deadline_ms < earliest)) {
+            earliest = timer->deadline_ms;
+            found = true;
+        }
+    }
+    if (found) {
+        int64_t delay = earliest - now_ms();
+        s_deadline_timer = app_timer_register(delay > 0 ? (uint32_t)delay : 1,
+                                              deadline_callback, NULL);
+    }
+}
+
+static void deadline_callback(void *data) {
+    s_deadline_timer = NULL;
+    int64_t now = now_ms();
+    bool completed = false;
+
+    for (int i = 0; i < WORKER_MAX_TIMERS; i++) {
+        WorkerTimer *timer = &s_timers[i];
+        if (timer->present && (timer->flags & WORKER_RECORD_RUNNING) && timer->deadline_ms <= now) {
+            timer->flags = (timer->flags & ~WORKER_RECORD_RUNNING) | WORKER_RECORD_COMPLETED;
+            timer->remaining_ms = 0;
+            completed = true;
+        }
+    }
+
+    // Workers cannot vibrate, so bring the app up to deliver the alert
+    if (completed) {
+        worker_launch_app();
+    }
+    arm_deadline_timer();
+}
+
+static void store_record(AppWorkerMessage *message) {
+    int index = message->data0 & WORKER_RECORD_INDEX_MASK;
+    if (index >= WORKER_MAX_TIMERS) {
+        return;
+    }
+
+    WorkerTimer *timer = &s_timers[index];
+    timer->present = true;
+    timer->flags = message->data0;
+    timer->remaining_ms = WORKER_RECORD_REMAINING(message);
+    timer->deadline_ms = now_ms() + timer->remaining_ms;
+}
+
+static void send_records() {
+    int64_t now = now_ms();
+
+    for (int i = 0; i < WORKER_MAX_TIMERS; i++) {
+        WorkerTimer *timer = &s_timers[i];
+        if (!timer->present) {
+            continue;
+        }
+
+        int32_t remaining = timer->remaining_ms;
+        if (timer->flags & WORKER_RECORD_RUNNING) {
+            int64_t left = timer->deadline_ms - now;
+            remaining = left > 0 ? (int32_t)left : 0;
+        }
+
+        AppWorkerMessage message = {
+            .data0 = timer->flags,
+            .data1 = (uint16_t)((uint32_t)remaining & 0xFFFF),
+            .data2 = (uint16_t)((uint32_t)remaining >> 16)
+        };
+        app_worker_send_message(WORKER_MSG_TIMER, &message);
+
+        // The app owns the timers again; it will hand them back on exit
+        timer->present = false;
+    }
+
+    AppWorkerMessage done = {0};
+    app_worker_send_message(WORKER_MSG_SYNC_DONE, &done);
+}
+
+static void message_handler(uint16_t type, AppWorkerMessage *message) {
+    switch (type) {
+        case WORKER_MSG_TIMER:
+            store_record(message);
+            break;
+        case WORKER_MSG_DETACH:
+            s_detached = true;
+            arm_deadline_timer();
+            break;
+        case WORKER_MSG_ATTACH:
+            s_detached = false;
+            arm_deadline_timer();
+            send_records();
+            break;
+    }
+}
+
+static void worker_init() {
+    app_worker_message_subscribe(message_handler);
+}
+
+static void worker_deinit() {
+    app_worker_message_unsubscribe();
+    if (s_deadline_timer) {
+        app_timer_cancel(s_deadline_timer);
+    }
+}
+
+int main(void) {
+    worker_init();
+    worker_event_loop();
+    worker_deinit();
+}